@@ -1,25 +1,54 @@
 #ifndef ALEF_NUMERICS_BIG_INTEGER_BIG_INTEGER_H
 #define ALEF_NUMERICS_BIG_INTEGER_BIG_INTEGER_H
 
+#include "conversion.h"
+#include "division.h"
+#include "gcd.h"
+#include "limb.h"
+#include "modular.h"
+#include "multiplication.h"
+#include "prime.h"
 #include "utility.h"
 #include "radix.h"
+#include "root.h"
+#include "scratch.h"
 
+#include <array>
+#include <bit>
+#include <cmath>
+#include <compare>
 #include <concepts>
+#include <limits>
+#include <memory_resource>
 #include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <sstream>
+#include <type_traits>
+#include <utility>
 
 namespace wingmann::numerics {
 
+class Modulus;
+
 /**
  * @brief Arbitrarily large integer.
+ *
+ * Limbs above 128 bits are allocated from the memory resource given on construction or by the
+ * global allocator. Plain copies use the global allocator, copies and moves taking an allocator
+ * use the given one. Results of arithmetic use the resource of the left operand, assignments keep
+ * the resource of the target.
  */
 class BigInteger {
 public:
     using RadixType = Radix;
     using SignType  = Sign;
-    using RadixFlag = RadixFlag;
-    using SignFlag  = SignFlag;
+    using RadixFlag = numerics::RadixFlag;
+    using SignFlag  = numerics::SignFlag;
+
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    friend class Modulus;
 
 protected:
     // The base of a system of number.
@@ -28,8 +57,8 @@ protected:
     // Sign flag.
     SignType sign_{SignFlag::positive};
 
-    // std::string representation of Decimal value.
-    std::string value_{"0"};
+    // Magnitude in binary limbs, the least significant limb first. Zero has no limbs.
+    __detail::Limbs value_{};
 
 public:
     /**
@@ -37,17 +66,36 @@ public:
      */
     BigInteger() = default;
 
+    /**
+     * @brief Constructs zero using the allocator.
+     * @param allocator Allocator of limbs.
+     */
+    explicit BigInteger(const allocator_type& allocator) : value_{resourceOf(allocator)} { }
+
     /**
      * @brief Destructor.
      */
-    virtual ~BigInteger() = default;
+    ~BigInteger() = default;
 
     /**
-     * @brief Copy constructor.
+     * @brief Copy constructor, the copy uses the global allocator whatever the allocator of the value.
      * @param other Value to copy.
      */
     BigInteger(const BigInteger& other) = default;
 
+    /**
+     * @brief Copy constructor using the allocator.
+     *
+     * @param other     Value to copy.
+     * @param allocator Allocator of limbs.
+     */
+    BigInteger(const BigInteger& other, const allocator_type& allocator)
+        : radix_{other.radix_},
+          sign_{other.sign_},
+          value_{other.value_.begin(), other.value_.end(), resourceOf(allocator)}
+    {
+    }
+
     /**
      * @brief Move constructor.
      * @param other Value to move.
@@ -60,13 +108,38 @@ public:
         setDefault(other);
     }
 
+    /**
+     * @brief Move constructor using the allocator, limbs are copied if the allocator differs.
+     *
+     * @param other     Value to move.
+     * @param allocator Allocator of limbs.
+     */
+    BigInteger(BigInteger&& other, const allocator_type& allocator)
+        : radix_{other.radix_},
+          sign_{other.sign_},
+          value_{resourceOf(allocator)}
+    {
+        this->value_ = std::move(other.value_);
+        setDefault(other);
+    }
+
     /**
      * @brief Constructs from integer.
      * @param value Integral value.
      */
     template<typename T>
     requires std::integral<T> && (!std::same_as<T, bool>)
-    BigInteger(T value) { *this = std::to_string(value); }
+    BigInteger(T value) { *this = value; }
+
+    /**
+     * @brief Constructs from integer using the allocator.
+     *
+     * @param value     Integral value.
+     * @param allocator Allocator of limbs.
+     */
+    template<typename T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+    BigInteger(T value, const allocator_type& allocator) : value_{resourceOf(allocator)} { *this = value; }
 
     /**
      * @brief Constructs from string literal.
@@ -96,6 +169,20 @@ public:
      */
     BigInteger(std::string value) : BigInteger{std::move(value), RadixFlag::Decimal} { }
 
+    /**
+     * @brief Constructs from string using the allocator.
+     *
+     * @param value     std::string value.
+     * @param radix     The base of a system of number.
+     * @param allocator Allocator of limbs.
+     */
+    BigInteger(std::string value, RadixFlag radix, const allocator_type& allocator)
+        : radix_{radix},
+          value_{resourceOf(allocator)}
+    {
+        *this = std::move(value);
+    }
+
     // Assignment operators ------------------------------------------------------------------------
 
     /**
@@ -107,12 +194,12 @@ public:
     BigInteger& operator=(const BigInteger& rhs) = default;
 
     /**
-     * @brief Move assignment operator.
+     * @brief Move assignment operator, limbs are copied if the allocator differs.
      *
      * @param rhs Value to move.
      * @return Constructed object.
      */
-    BigInteger& operator=(BigInteger&& rhs) noexcept {
+    BigInteger& operator=(BigInteger&& rhs) {
         this->radix_ = rhs.radix_;
         this->sign_ = rhs.sign_;
         this->value_ = std::move(rhs.value_);
@@ -121,6 +208,20 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Assignment operator evaluating the lazy expression in the buffer of the current value.
+     *
+     * @param rhs Expression to evaluate.
+     * @return Modified object.
+     */
+    template<typename Expression>
+    requires requires(const Expression& expression, BigInteger& destination) {
+        { expression.evaluateInto(destination) } -> std::same_as<BigInteger&>;
+    }
+    BigInteger& operator=(const Expression& rhs) {
+        return rhs.evaluateInto(*this);
+    }
+
     /**
      * @brief Constructs from an integer rhs.
      *
@@ -130,7 +231,29 @@ public:
     template<typename T>
     requires std::integral<T> && (!std::same_as<T, bool>)
     BigInteger& operator=(T rhs) {
-        *this = std::to_string(rhs);
+        using UnsignedType = std::make_unsigned_t<T>;
+        auto magnitude = static_cast<UnsignedType>(rhs);
+
+        this->sign_.value = SignFlag::positive;
+
+        if constexpr (std::signed_integral<T>) {
+            if (rhs < 0) {
+                magnitude = static_cast<UnsignedType>(UnsignedType{} - magnitude);
+                this->sign_.value = SignFlag::negative;
+            }
+        }
+        this->value_.clear();
+
+        // Integers wider than a limb, like 128-bit ones, are pushed limb by limb.
+        while (magnitude != 0) {
+            this->value_.push_back(static_cast<__detail::Limb>(magnitude));
+
+            if constexpr (sizeof(UnsignedType) > sizeof(__detail::Limb)) {
+                magnitude >>= __detail::limbBits;
+            } else {
+                magnitude = 0;
+            }
+        }
         return *this;
     }
 
@@ -152,9 +275,9 @@ public:
      * @return Constructed object.
      */
     BigInteger& operator=(std::string value) {
-        this->sign_.value = (value.starts_with('-') ? SignFlag::negative : SignFlag::positive);
+        auto negative = value.starts_with('-');
 
-        if (this->isNegative()) {
+        if (negative) {
             __detail::removeSign(value);
         }
         if (!__detail::isValidNumber(value, this->radix_.value)) {
@@ -162,11 +285,9 @@ public:
         }
         __detail::removeLeadingZeros(value);
 
-        if (this->radix_.value == RadixFlag::Decimal) {
-            this->value_ = std::move(value);
-        } else {
-            this->value_ = convertToBaseTen(value, this->radix_.value);
-        }
+        this->value_ = convertFromString(value, this->radix_.value);
+        this->sign_.value = (negative && !this->value_.empty()) ? SignFlag::negative : SignFlag::positive;
+
         return *this;
     }
 
@@ -177,8 +298,8 @@ public:
      * @return Modified object.
      */
     BigInteger& operator++() {
-        *this = this->add(1);
-        return *this;
+        const __detail::Limb one{1};
+        return this->addSignedAssign(&one, 1, false);
     }
 
     /**
@@ -186,7 +307,7 @@ public:
      * @return Copy of current value.
      */
     BigInteger operator++(int) {
-        auto temp{*this};
+        BigInteger temp{*this, this->get_allocator()};
         ++(*this);
         return temp;
     }
@@ -196,8 +317,8 @@ public:
      * @return Modified object.
      */
     BigInteger& operator--() {
-        *this = this->subtract(1);
-        return *this;
+        const __detail::Limb one{1};
+        return this->addSignedAssign(&one, 1, true);
     }
 
     /**
@@ -205,56 +326,203 @@ public:
      * @return Copy of current value.
      */
     BigInteger operator--(int) {
-        auto temp{*this};
+        BigInteger temp{*this, this->get_allocator()};
         --(*this);
         return temp;
     }
 
     // Shift operations -----------------------------------------------------------------------------
 
+    /**
+     * @brief Shifts the magnitude of the current value to left on right operand value.
+     *
+     * @param rhs The count of bits to shift on.
+     * @return Modified object.
+     */
+    template<typename T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+    BigInteger& shiftLeftAssign(T rhs) {
+        return this->shiftMagnitudeLeft(shiftCount(rhs));
+    }
+
+    /**
+     * @brief Shifts the magnitude of the current value to left on right operand value.
+     *
+     * @param rhs The count of bits to shift on.
+     * @return Modified object.
+     */
+    BigInteger& shiftLeftAssign(const BigInteger& rhs) {
+        return this->shiftMagnitudeLeft(shiftCount(rhs));
+    }
+
+    /**
+     * @brief Shifts the magnitude of the current value to right on right operand value,
+     *        the result is truncated toward zero.
+     *
+     * @param rhs The count of bits to shift on.
+     * @return Modified object.
+     */
+    template<typename T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+    BigInteger& shiftRightAssign(T rhs) {
+        return this->shiftMagnitudeRight(shiftCount(rhs));
+    }
+
+    /**
+     * @brief Shifts the magnitude of the current value to right on right operand value,
+     *        the result is truncated toward zero.
+     *
+     * @param rhs The count of bits to shift on.
+     * @return Modified object.
+     */
+    BigInteger& shiftRightAssign(const BigInteger& rhs) {
+        return this->shiftMagnitudeRight(shiftCount(rhs));
+    }
+
+    /**
+     * @brief Shifts the current value to left on right operand value.
+     *
+     * @param rhs The count of bits to shift on.
+     * @return Shifted current value.
+     */
+    template<typename T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+    [[nodiscard]]
+    BigInteger shiftLeft(T rhs) const {
+        BigInteger result{*this, this->get_allocator()};
+        result.shiftLeftAssign(rhs);
+
+        return result;
+    }
+
     /**
      * @brief Shifts the current value to left on right operand value.
      *
-     * @param rhs The value to shiftRight on.
+     * @param rhs The count of bits to shift on.
      * @return Shifted current value.
      */
     [[nodiscard]]
     BigInteger shiftLeft(const BigInteger& rhs) const {
-        if (rhs.isNegative()) {
-            throw std::invalid_argument{"negative value"};
-        }
-        auto bitwiseValue = this->to_string(RadixFlag::Binary);
-        auto i = valueFrom(0);
+        BigInteger result{*this, this->get_allocator()};
+        result.shiftLeftAssign(rhs);
 
-        while (i.compare(rhs) == std::strong_ordering::less) {
-            bitwiseValue.push_back('0');
-            ++i;
-        }
-        return {std::move(bitwiseValue), RadixFlag::Binary};
+        return result;
+    }
+
+    /**
+     * @brief Shifts the current value to right on right operand value.
+     *
+     * @param rhs The count of bits to shift on.
+     * @return Shifted current value.
+     */
+    template<typename T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+    [[nodiscard]]
+    BigInteger shiftRight(T rhs) const {
+        BigInteger result{*this, this->get_allocator()};
+        result.shiftRightAssign(rhs);
+
+        return result;
     }
 
     /**
      * @brief Shifts the current value to right on right operand value.
      *
-     * @param rhs The value to shiftRight on.
+     * @param rhs The count of bits to shift on.
      * @return Shifted current value.
      */
     [[nodiscard]]
     BigInteger shiftRight(const BigInteger& rhs) const {
-        if (rhs.isNegative()) {
-            throw std::invalid_argument{"negative value"};
-        }
-        auto bitwiseValue = this->to_string(RadixFlag::Binary);
-        auto i = valueFrom(0);
+        BigInteger result{*this, this->get_allocator()};
+        result.shiftRightAssign(rhs);
 
-        while ((i.compare(rhs) == std::strong_ordering::less) && (bitwiseValue.length() > 0)) {
-            bitwiseValue.pop_back();
-            ++i;
-        }
-        if (bitwiseValue.empty()) {
-            bitwiseValue.push_back('0');
-        }
-        return {std::move(bitwiseValue), RadixFlag::Binary};
+        return result;
+    }
+
+    // Bitwise operations ---------------------------------------------------------------------------
+
+    /**
+     * @brief Computes bitwise AND with value in the buffer of the current value, negative
+     *        values take the infinite two's complement form.
+     *
+     * @param rhs The right operand.
+     * @return Modified object.
+     */
+    BigInteger& bitwiseAndAssign(const BigInteger& rhs) {
+        return this->bitwiseAssign(rhs, [](__detail::Limb left, __detail::Limb right) { return left & right; });
+    }
+
+    /**
+     * @brief Computes bitwise OR with value in the buffer of the current value, negative
+     *        values take the infinite two's complement form.
+     *
+     * @param rhs The right operand.
+     * @return Modified object.
+     */
+    BigInteger& bitwiseOrAssign(const BigInteger& rhs) {
+        return this->bitwiseAssign(rhs, [](__detail::Limb left, __detail::Limb right) { return left | right; });
+    }
+
+    /**
+     * @brief Computes bitwise XOR with value in the buffer of the current value, negative
+     *        values take the infinite two's complement form.
+     *
+     * @param rhs The right operand.
+     * @return Modified object.
+     */
+    BigInteger& bitwiseXorAssign(const BigInteger& rhs) {
+        return this->bitwiseAssign(rhs, [](__detail::Limb left, __detail::Limb right) { return left ^ right; });
+    }
+
+    /**
+     * @brief Computes bitwise AND, negative values take the infinite two's complement form.
+     *
+     * @param rhs The right operand.
+     * @return Result of bitwise AND.
+     */
+    [[nodiscard]]
+    BigInteger bitwiseAnd(const BigInteger& rhs) const {
+        BigInteger result{*this, this->get_allocator()};
+        result.bitwiseAndAssign(rhs);
+
+        return result;
+    }
+
+    /**
+     * @brief Computes bitwise OR, negative values take the infinite two's complement form.
+     *
+     * @param rhs The right operand.
+     * @return Result of bitwise OR.
+     */
+    [[nodiscard]]
+    BigInteger bitwiseOr(const BigInteger& rhs) const {
+        BigInteger result{*this, this->get_allocator()};
+        result.bitwiseOrAssign(rhs);
+
+        return result;
+    }
+
+    /**
+     * @brief Computes bitwise XOR, negative values take the infinite two's complement form.
+     *
+     * @param rhs The right operand.
+     * @return Result of bitwise XOR.
+     */
+    [[nodiscard]]
+    BigInteger bitwiseXor(const BigInteger& rhs) const {
+        BigInteger result{*this, this->get_allocator()};
+        result.bitwiseXorAssign(rhs);
+
+        return result;
+    }
+
+    /**
+     * @brief Computes bitwise NOT in the infinite two's complement form, that is -value - 1.
+     * @return Result of bitwise NOT.
+     */
+    [[nodiscard]]
+    BigInteger bitwiseNot() const {
+        return this->negate().subtract(1);
     }
 
     // Comparison ----------------------------------------------------------------------------------
@@ -267,43 +535,17 @@ public:
      */
     [[nodiscard]]
     std::strong_ordering compare(const BigInteger& rhs) const {
-        // -a, +b
-        if (this->isNegative() && rhs.isPositive()) {
-            return std::strong_ordering::less;
-        }
-
-        // +a, -b
-        if (this->isPositive() && rhs.isNegative()) {
-            return std::strong_ordering::greater;
+        // -a, +b or +a, -b
+        if (this->isNegative() != rhs.isNegative()) {
+            return this->isNegative() ? std::strong_ordering::less : std::strong_ordering::greater;
         }
+        auto order = compareMagnitudes(this->value_, rhs.value_);
 
         // -a, -b
-        if (this->isNegative() && rhs.isNegative()) {
-            if (this->value_.length() == rhs.value_.length()) {
-                if (this->value_ > rhs.value_) {
-                    return std::strong_ordering::less;
-                }
-                return (this->value_ == rhs.value_)
-                    ? std::strong_ordering::equivalent
-                    : std::strong_ordering::greater;
-            }
-            return (this->value_.length() < rhs.value_.length())
-                ? std::strong_ordering::greater
-                : std::strong_ordering::less;
-        }
-
-        // +a, +b
-        if (this->value_.length() == rhs.value_.length()) {
-            if (this->value_ > rhs.value_) {
-                return std::strong_ordering::greater;
-            }
-            return (this->value_ == rhs.value_)
-                ? std::strong_ordering::equivalent
-                : std::strong_ordering::less;
+        if (this->isNegative()) {
+            order = -order;
         }
-        return (this->value_.length() < rhs.value_.length())
-            ? std::strong_ordering::less
-            : std::strong_ordering::greater;
+        return order <=> 0;
     }
 
     /**
@@ -327,57 +569,10 @@ public:
      */
     [[nodiscard]]
     BigInteger add(const BigInteger& rhs) const {
-        // (-a)+(+b)
-        if (this->isNegative() && rhs.isPositive()) {
-            return rhs.subtract(this->negate());
-        }
-
-        // (+a)+(-b)
-        if (this->isPositive() && rhs.isNegative()) {
-            return this->subtract(rhs.negate());
-        }
-
-        // (+a)+(+b) or (-a)+(-b)
-        auto lhsValue = this->value_;
-        auto rhsValue = rhs.value_;
-
-        auto diffLength = std::abs(static_cast<int>(lhsValue.length() - rhsValue.length()));
-
-        const auto minValue{'0'};
-        const auto maxValue{'9'};
-
-        if (lhsValue.length() > rhsValue.length()) {
-            rhsValue.insert(0, diffLength, minValue);
-        } else {
-            lhsValue.insert(0, diffLength, minValue);
-        }
-        std::ranges::reverse(lhsValue);
-        std::ranges::reverse(rhsValue);
-
-        std::size_t index{};
-        char carry{minValue};
-
-        for (char& lhsChar : lhsValue) {
-            lhsChar = static_cast<char>(
-                    (carry - minValue) +
-                    (lhsChar - minValue) +
-                    (rhsValue.at(index) - minValue) +
-                    minValue);
+        BigInteger result{*this, this->get_allocator()};
+        result.addAssign(rhs);
 
-            if (lhsChar > maxValue) {
-                lhsChar -= 10;
-                carry = (minValue + 1);
-            } else {
-                carry = minValue;
-            }
-            ++index;
-        }
-        if (carry > minValue) {
-            lhsValue.append(1, carry);
-        }
-        std::ranges::reverse(lhsValue);
-
-        return this->isNegative() ? valueFrom(lhsValue).negate() : std::move(lhsValue);
+        return result;
     }
 
     /**
@@ -388,52 +583,10 @@ public:
      */
     [[nodiscard]]
     BigInteger subtract(const BigInteger& rhs) const {
-        // (-a)-(+b) or (+a)-(-b)
-        if ((this->isNegative() && rhs.isPositive()) ||
-            (this->isPositive() && rhs.isNegative()))
-        {
-            return this->add(rhs.negate());
-        }
-
-        // (+a)-(+b) or (-a)-(-b)
-        if (this->isNegative()) {
-            return this->add(rhs.negate());
-        }
-        bool inverted_sign = (this->compare(rhs) == std::strong_ordering::less);
-
-        std::string subtracted = inverted_sign ? rhs.value_ : this->value_;
-        std::string removed = inverted_sign ? this->value_ : rhs.value_;
-
-        auto diffLength = std::abs(static_cast<int>(subtracted.length() - removed.length()));
-
-        const auto minValue{'0'};
-
-        if (subtracted.size() > removed.size()) {
-            removed.insert(0, diffLength, minValue);
-        } else {
-            subtracted.insert(0, diffLength, minValue);
-        }
-        std::ranges::reverse(subtracted);
-        std::ranges::reverse(removed);
+        BigInteger result{*this, this->get_allocator()};
+        result.subtractAssign(rhs);
 
-        std::size_t index{};
-
-        for (char& symbol : subtracted) {
-            if (symbol < removed.at(index)) {
-                symbol += 10;
-                --subtracted.at(index + 1);
-            }
-            symbol = static_cast<char>(
-                    (symbol - minValue) - (removed.at(index) - minValue) + minValue);
-
-            ++index;
-        }
-        std::ranges::reverse(subtracted);
-
-        while (subtracted.front() == minValue && subtracted.length() != 1) {
-            subtracted.erase(0, 1);
-        }
-        return inverted_sign ? valueFrom(subtracted).negate() : std::move(subtracted);
+        return result;
     }
 
     /**
@@ -444,46 +597,18 @@ public:
      */
     [[nodiscard]]
     BigInteger multiply(const BigInteger& rhs) const {
-        auto lhsValue = this->value_;
-        auto rhsValue = rhs.value_;
-
-        std::ranges::reverse(lhsValue);
-        std::ranges::reverse(rhsValue);
-
-        const auto minValue{'0'};
-        const auto maxValue{'9'};
-
-        int index{};
-        char carry{minValue};
-
-        auto temp = valueFrom(0);
-        std::uint8_t result;
-
-        for (const auto& lhsChar : lhsValue) {
-            auto operation = std::string{}.insert(0, index, minValue);
-
-            for (const auto& rhsChar : rhsValue) {
-                result = ((lhsChar - minValue) * (rhsChar - minValue)) + (carry - minValue) + minValue;
-                carry = minValue;
-
-                if (result > maxValue) {
-                    while (result > maxValue) {
-                        result -= 10;
-                        ++carry;
-                    }
-                }
-                operation.insert(0, 1, static_cast<char>(result));
-            }
-            if (carry > minValue) {
-                operation.insert(0, 1, carry);
-                carry = minValue;
-            }
-            temp = temp.add(operation);
-            ++index;
-        }
-        auto positive = (this->isNegative() && rhs.isNegative()) || (this->isPositive() && rhs.isPositive());
+        return fromLimbs(
+            multiplyMagnitudes(this->value_, rhs.value_),
+            this->isNegative() != rhs.isNegative());
+    }
 
-        return positive ? std::move(temp) : temp.negate();
+    /**
+     * @brief Squares value, every cross product of the limbs is computed once.
+     * @return Square of the current value.
+     */
+    [[nodiscard]]
+    BigInteger square() const {
+        return fromLimbs(multiplyMagnitudes(this->value_, this->value_), false);
     }
 
     /**
@@ -494,48 +619,7 @@ public:
      */
     [[nodiscard]]
     BigInteger divide(const BigInteger& rhs) const {
-        if (rhs.equal(0)) {
-            throw std::invalid_argument("divide by zero");
-        }
-        if (rhs.equal(1)) {
-            return *this;
-        }
-        if (this->equal(rhs)) {
-            return 1;
-        }
-        auto lhsValue = this->value_;
-        std::ranges::reverse(lhsValue);
-
-        auto rhsAbs = rhs.abs();
-
-        std::string lhsQuotient;
-        std::string rhsQuotient;
-
-        do {
-            lhsQuotient.push_back(lhsValue.back());
-            lhsValue.pop_back();
-
-            BigInteger dividend_value{lhsQuotient};
-
-            if (dividend_value.compare(rhsAbs) == std::strong_ordering::less) {
-                rhsQuotient.push_back('0');
-                continue;
-            }
-            auto number = valueFrom(2);
-            auto mul = rhsAbs.multiply(number).compare(dividend_value);
-
-            while (mul == std::strong_ordering::less || mul == std::strong_ordering::equal) {
-                ++number;
-                mul = rhsAbs.multiply(number).compare(dividend_value);
-            }
-            --number;
-            rhsQuotient.append(number.to_string());
-            lhsQuotient = dividend_value.subtract(rhsAbs.multiply(number)).to_string();
-        } while (!lhsValue.empty());
-
-        auto positive = (this->isNegative() && rhs.isNegative()) || (this->isPositive() && rhs.isPositive());
-
-        return positive ? std::move(rhsQuotient) : valueFrom(rhsQuotient).negate();
+        return this->divmod(rhs).first;
     }
 
     /**
@@ -546,30 +630,259 @@ public:
      */
     [[nodiscard]]
     BigInteger mod(const BigInteger& rhs) const {
-        if (rhs.equal(0)) {
-            throw std::invalid_argument("mod by zero");
-        }
-        return this->subtract(rhs.multiply(this->divide(rhs)));
+        return this->divmod(rhs).second;
     }
 
-    // Complex arithmetic --------------------------------------------------------------------------
-
     /**
-     * @brief Reverses the sign.
-     * @return If current value signed then current value otherwise sign reversed.
+     * @brief Divides value with truncation toward zero, the remainder takes the sign of the
+     *        current value.
+     *
+     * @param rhs The right operand by which to divide the current value.
+     * @return Quotient and remainder.
      */
     [[nodiscard]]
-    BigInteger negate() const {
-        if (this->equal(0)) {
-            return *this;
+    std::pair<BigInteger, BigInteger> divmod(const BigInteger& rhs) const {
+        if (rhs.value_.empty()) {
+            throw std::invalid_argument("divide by zero");
         }
-        if (this->isNegative()) {
-            return this->value_;
+        auto [quotient, remainder] = divideMagnitudes(this->value_, rhs.value_);
+
+        return {
+            fromLimbs(std::move(quotient), this->isNegative() != rhs.isNegative()),
+            fromLimbs(std::move(remainder), this->isNegative())};
+    }
+
+    /**
+     * @brief Divides value with rounding toward negative infinity, the remainder takes the sign
+     *        of the right operand.
+     *
+     * @param rhs The right operand by which to divide the current value.
+     * @return Quotient and remainder.
+     */
+    [[nodiscard]]
+    std::pair<BigInteger, BigInteger> divmodFloor(const BigInteger& rhs) const {
+        auto result = this->divmod(rhs);
+        auto& [quotient, remainder] = result;
+
+        if (!remainder.value_.empty() && (this->isNegative() != rhs.isNegative())) {
+            quotient = quotient.subtract(1);
+            remainder = remainder.add(rhs);
+        }
+        return result;
+    }
+
+    // In-place arithmetic -------------------------------------------------------------------------
+
+    /**
+     * @brief Adds value to the current value in its buffer.
+     *
+     * @param rhs The right side operand for addition to current value.
+     * @return Modified object.
+     */
+    BigInteger& addAssign(const BigInteger& rhs) {
+        return this->addSignedAssign(rhs.value_.data(), rhs.value_.size(), rhs.isNegative());
+    }
+
+    /**
+     * @brief Subtracts value from the current value in its buffer.
+     *
+     * @param rhs The right side operand for subtract from current value.
+     * @return Modified object.
+     */
+    BigInteger& subtractAssign(const BigInteger& rhs) {
+        return this->addSignedAssign(rhs.value_.data(), rhs.value_.size(), rhs.isPositive());
+    }
+
+    /**
+     * @brief Multiplies the current value by value, a single limb multiplier works in the buffer
+     *        of the current value.
+     *
+     * @param rhs The right operand for multiplication by the current value.
+     * @return Modified object.
+     */
+    BigInteger& multiplyAssign(const BigInteger& rhs) {
+        auto negative = this->isNegative() != rhs.isNegative();
+
+        if (this->value_.empty() || rhs.value_.empty()) {
+            this->value_.clear();
+        } else if (rhs.value_.size() == 1) {
+            auto size = this->value_.size();
+            auto carry = __detail::multiplyLimb(this->value_.data(), this->value_.data(), size, rhs.value_[0]);
+
+            if (carry != 0) {
+                this->value_.push_back(carry);
+            }
+        } else {
+            this->value_ = multiplyMagnitudes(this->value_, rhs.value_);
+            __detail::trim(this->value_);
+        }
+        return this->setSign(negative);
+    }
+
+    /**
+     * @brief Divides the current value by value, a single limb divisor works in the buffer of
+     *        the current value.
+     *
+     * @param rhs The right operand by which to divide the current value.
+     * @return Modified object.
+     */
+    BigInteger& divideAssign(const BigInteger& rhs) {
+        if (rhs.value_.empty()) {
+            throw std::invalid_argument("divide by zero");
+        }
+        auto negative = this->isNegative() != rhs.isNegative();
+
+        if (rhs.value_.size() == 1) {
+            auto size = this->value_.size();
+            __detail::divideLimb(this->value_.data(), this->value_.data(), size, rhs.value_[0]);
+        } else {
+            this->value_ = divideMagnitudes(this->value_, rhs.value_).first;
+        }
+        __detail::trim(this->value_);
+
+        return this->setSign(negative);
+    }
+
+    /**
+     * @brief Replaces the current value by the remainder of division by value, a single limb
+     *        divisor works in the buffer of the current value.
+     *
+     * @param rhs The right operand for taking the remainder.
+     * @return Modified object.
+     */
+    BigInteger& modAssign(const BigInteger& rhs) {
+        if (rhs.value_.empty()) {
+            throw std::invalid_argument("divide by zero");
+        }
+        if (rhs.value_.size() == 1) {
+            auto size = this->value_.size();
+            auto remainder = __detail::divideLimb(this->value_.data(), this->value_.data(), size, rhs.value_[0]);
+
+            this->value_.clear();
+
+            if (remainder != 0) {
+                this->value_.push_back(remainder);
+            }
+        } else {
+            this->value_ = divideMagnitudes(this->value_, rhs.value_).second;
+            __detail::trim(this->value_);
+        }
+        return this->setSign(this->isNegative());
+    }
+
+    // Fused arithmetic ----------------------------------------------------------------------------
+
+    /**
+     * @brief Adds the product of values to the current value, the product is kept in the scratch
+     *        space or, for a single limb factor, accumulated in the buffer of the current value.
+     *
+     * @param lhs The left operand of multiplication.
+     * @param rhs The right operand of multiplication.
+     * @return Modified object.
+     */
+    BigInteger& addMultiplyAssign(const BigInteger& lhs, const BigInteger& rhs) {
+        return this->multiplyAccumulate(lhs, rhs, lhs.isNegative() != rhs.isNegative());
+    }
+
+    /**
+     * @brief Subtracts the product of values from the current value, the product is kept in the
+     *        scratch space or, for a single limb factor, accumulated in the buffer of the current
+     *        value.
+     *
+     * @param lhs The left operand of multiplication.
+     * @param rhs The right operand of multiplication.
+     * @return Modified object.
+     */
+    BigInteger& subtractMultiplyAssign(const BigInteger& lhs, const BigInteger& rhs) {
+        return this->multiplyAccumulate(lhs, rhs, lhs.isNegative() == rhs.isNegative());
+    }
+
+    /**
+     * @brief Replaces the current value by the remainder of its product with value divided by
+     *        the modulus, the remainder takes the sign of the product.
+     *
+     * @param rhs     The right operand of multiplication.
+     * @param modulus The divisor of the product.
+     * @return Modified object.
+     */
+    BigInteger& multiplyModAssign(const BigInteger& rhs, const BigInteger& modulus) {
+        if (modulus.value_.empty()) {
+            throw std::invalid_argument("divide by zero");
+        }
+        auto negative = this->isNegative() != rhs.isNegative();
+
+        if (this->value_.empty() || rhs.value_.empty()) {
+            this->value_.clear();
+            return this->setSign(negative);
         }
-        std::stringstream ss;
-        ss << '-' << this->value_;
+        __detail::ScratchLimbs product(this->value_.size() + rhs.value_.size());
+        __detail::multiply(
+            product.data(),
+            this->value_.data(),
+            this->value_.size(),
+            rhs.value_.data(),
+            rhs.value_.size());
+
+        auto size = __detail::trimmedSize(product.data(), product.size());
+        const auto& divisor = modulus.value_;
+
+        if (__detail::compareLimbs(product.data(), size, divisor.data(), divisor.size()) < 0) {
+            this->value_.resize(size);
+            std::copy(product.data(), product.data() + size, this->value_.data());
+
+            return this->setSign(negative);
+        }
+        __detail::ScratchLimbs quotient(size - divisor.size() + 1);
+        __detail::ScratchLimbs remainder(divisor.size());
+
+        __detail::divide(quotient.data(), remainder.data(), product.data(), size, divisor.data(), divisor.size());
+
+        this->value_.resize(remainder.size());
+        std::copy(remainder.begin(), remainder.end(), this->value_.data());
+        __detail::trim(this->value_);
+
+        return this->setSign(negative);
+    }
+
+    /**
+     * @brief Computes the remainder of the product by the modulus without a full size product
+     *        value, the remainder takes the sign of the product.
+     *
+     * @param rhs     The right operand of multiplication.
+     * @param modulus The divisor of the product.
+     * @return Remainder of the product.
+     */
+    [[nodiscard]]
+    BigInteger multiplyMod(const BigInteger& rhs, const BigInteger& modulus) const {
+        BigInteger result{*this, this->get_allocator()};
+        result.multiplyModAssign(rhs, modulus);
+
+        return result;
+    }
+
+    // Complex arithmetic --------------------------------------------------------------------------
+
+    /**
+     * @brief Reverses the sign.
+     * @return If current value signed then current value otherwise sign reversed.
+     */
+    [[nodiscard]]
+    BigInteger negate() const {
+        BigInteger result{*this, this->get_allocator()};
+        result.negateAssign();
+
+        return result;
+    }
 
-        return ss.str();
+    /**
+     * @brief Reverses the sign of the current value.
+     * @return Modified object.
+     */
+    BigInteger& negateAssign() {
+        if (!this->value_.empty()) {
+            this->sign_.reverse();
+        }
+        return *this;
     }
 
     /**
@@ -578,7 +891,7 @@ public:
      */
     [[nodiscard]]
     BigInteger abs() const {
-        return this->isPositive() ? *this : this->negate();
+        return this->isPositive() ? BigInteger{*this, this->get_allocator()} : this->negate();
     }
 
     /**
@@ -596,20 +909,86 @@ public:
             return 0;
         }
         if (rhs.compare(0) == std::strong_ordering::less) {
-            return this->abs().equal(1) ? *this : 0;
+            return this->abs().equal(1) ? BigInteger{*this, this->get_allocator()} : BigInteger{};
         }
-        auto initExp{rhs};
-        auto result{*this};
-        auto resultOdd = valueFrom(1);
+        return this->powMagnitude(rhs.value_.data(), rhs.value_.size());
+    }
 
-        while (initExp.compare(1) == std::strong_ordering::greater) {
-            if (initExp.mod(2)) {
-                resultOdd = resultOdd.multiply(result);
-            }
-            result = result.multiply(result);
-            initExp = initExp.divide(2);
+    /**
+     * @brief Rises the current value to the power of the right operand.
+     *
+     * @param rhs Degree.
+     * @return Current value raised to the power.
+     */
+    template<typename T>
+    requires std::integral<T> && (!std::same_as<T, bool>)
+    [[nodiscard]]
+    BigInteger pow(T rhs) const {
+        if (rhs == 0) {
+            return 1;
+        }
+        if (this->equal(0)) {
+            return 0;
+        }
+        if (std::cmp_less(rhs, 0)) {
+            return this->abs().equal(1) ? BigInteger{*this, this->get_allocator()} : BigInteger{};
         }
-        return result.multiply(resultOdd);
+        // Exponents wider than a limb, like 128-bit ones, take the path of long exponents.
+        if (std::cmp_greater(rhs, std::numeric_limits<__detail::Limb>::max())) {
+            return this->pow(BigInteger{rhs});
+        }
+        const auto exponent = static_cast<__detail::Limb>(rhs);
+
+        return this->powMagnitude(&exponent, 1);
+    }
+
+    /**
+     * @brief Raises the current value to the power modulo the modulus without the full power.
+     *
+     * Odd moduli use Montgomery multiplication, the exponent is scanned by sliding windows.
+     *
+     * @param exponent The exponent, a negative one raises the modular inverse.
+     * @param modulus  Not zero modulus, its sign is ignored.
+     * @return Residue of the power in the range [0, |modulus|).
+     */
+    [[nodiscard]]
+    BigInteger powMod(const BigInteger& exponent, const BigInteger& modulus) const {
+        if (modulus.value_.empty()) {
+            throw std::invalid_argument("divide by zero");
+        }
+        if (exponent.isNegative()) {
+            return this->modInverse(modulus).powMod(exponent.negate(), modulus);
+        }
+        const auto& divisor = modulus.value_;
+        const auto size = divisor.size();
+
+        if (size == 1 && divisor[0] == 1) {
+            return BigInteger{this->get_allocator()};
+        }
+        if (exponent.value_.empty()) {
+            return BigInteger{1, this->get_allocator()};
+        }
+        BigInteger base{*this, this->get_allocator()};
+        base.modAssign(modulus);
+
+        if (base.isNegative()) {
+            base.addSignedAssign(divisor.data(), size, false);
+        }
+        if (base.value_.empty()) {
+            return base;
+        }
+        base.value_.resize(size);
+
+        __detail::Limbs result(size, this->value_.resource());
+        __detail::powerModulo(
+            result.data(),
+            base.value_.data(),
+            exponent.value_.data(),
+            exponent.value_.size(),
+            divisor.data(),
+            size);
+
+        return fromLimbs(std::move(result), false);
     }
 
     /**
@@ -618,64 +997,237 @@ public:
      */
     [[nodiscard]]
     BigInteger pow10() const {
-        return valueFrom(10).pow(*this);
+        return BigInteger{10, this->get_allocator()}.pow(*this);
     }
 
     /**
      * @brief Computes square root.
-     * @return Square root of current value.
+     * @return Square root of current value rounded down.
      */
     [[nodiscard]]
     BigInteger sqrt() const {
-        if (this->compare(0) == std::strong_ordering::less) {
+        return this->sqrtRem().first;
+    }
+
+    /**
+     * @brief Computes square root with the remainder by Zimmermann's Karatsuba square root.
+     * @return Root s and remainder r such that current value = s^2 + r and 0 <= r <= 2 * s.
+     */
+    [[nodiscard]]
+    std::pair<BigInteger, BigInteger> sqrtRem() const {
+        if (this->isNegative()) {
             throw std::invalid_argument("sqrt of a negative value");
         }
+        __detail::Limbs root{this->value_.resource()};
+        __detail::Limbs remainder{this->value_.resource()};
 
-        // Small numbers optimisation.
-        if (this->equal(0)) {
-            return 0;
+        if (!this->value_.empty()) {
+            __detail::sqrtRemainder(root, remainder, this->value_.data(), this->value_.size());
         }
-        if (this->compare(4) == std::strong_ordering::less) {
-            return 1;
+        return {fromLimbs(std::move(root), false), fromLimbs(std::move(remainder), false)};
+    }
+
+    /**
+     * @brief Computes the integer root of the degree.
+     *
+     * The root of the leading part of the value is refined by Newton's iteration from above.
+     *
+     * @param degree Not zero degree, negative values have roots of odd degrees only.
+     * @return Root of current value rounded toward zero.
+     */
+    [[nodiscard]]
+    BigInteger iroot(std::uint64_t degree) const {
+        if (degree == 0) {
+            throw std::invalid_argument("root of zero degree");
         }
-        if (this->compare(9) == std::strong_ordering::less) {
-            return 2;
+        if (this->isNegative()) {
+            if (degree % 2 == 0) {
+                throw std::invalid_argument("root of a negative value");
+            }
+            return this->negate().iroot(degree).negate();
+        }
+        if (degree == 1 || this->value_.empty()) {
+            return BigInteger{*this, this->get_allocator()};
+        }
+        if (degree == 2) {
+            return this->sqrt();
         }
-        if (this->compare(16) == std::strong_ordering::less) {
-            return 3;
+        auto bits = this->bitLength();
+
+        // Values below 2^degree have the root 1.
+        if (bits <= degree) {
+            return BigInteger{1, this->get_allocator()};
         }
-        auto previous = valueFrom(-1);
-        auto current = valueFrom(this->to_string().size() / 2 - 1).pow10();
+        auto rootBits = (bits + degree - 1) / degree;
+        BigInteger root;
+
+        if (rootBits <= __detail::limbBits) {
+            // The floating estimate of the leading bits is raised to stay above the root.
+            auto top = this->shiftRight(bits > __detail::limbBits ? bits - __detail::limbBits : 0);
+            auto logarithm = std::log2(static_cast<double>(top.value_[0])) +
+                static_cast<double>(bits > __detail::limbBits ? bits - __detail::limbBits : 0);
+            auto estimate = std::exp2(logarithm / static_cast<double>(degree)) * (1.0 + 0x1p-40) + 2.0;
 
-        while (current.subtract(previous).abs().compare(1) == std::strong_ordering::greater) {
-            previous = current;
-            current = this->divide(previous).add(previous).divide(2);
+            root = (estimate >= 0x1p64) ? BigInteger{1}.shiftLeft(rootBits) : BigInteger{static_cast<std::uint64_t>(estimate)};
+        } else {
+            // The root of the leading part has about a half of the bits of the root.
+            auto shift = rootBits / 2;
+            root = this->shiftRight(shift * degree).iroot(degree).add(1).shiftLeft(shift);
+        }
+        auto power = valueFrom(degree - 1);
+
+        for (;;) {
+            // x' = ((degree - 1) * x + value / x^(degree - 1)) / degree
+            auto next = root.multiply(power);
+            next.addAssign(this->divide(root.pow(power)));
+            next.divideAssign(valueFrom(degree));
+
+            if (next.compare(root) != std::strong_ordering::less) {
+                return root;
+            }
+            root = std::move(next);
         }
-        return current;
     }
 
     /**
-     * @brief Computes the greatest common divisor.
+     * @brief Computes the greatest common divisor by Lehmer's algorithm on leading limbs, long
+     *        operands are reduced by the subquadratic half-gcd first.
      *
      * @param rhs The right operand.
-     * @return Greatest common divisor of the current value and right operand.
+     * @return Not negative greatest common divisor of the current value and right operand.
      */
     [[nodiscard]]
     BigInteger gcd(const BigInteger& rhs) const {
-        auto lhsAbs = this->abs();
-        auto rhsAbs = rhs.abs();
+        const auto& [lhsValue, rhsValue] = (compareMagnitudes(this->value_, rhs.value_) >= 0)
+            ? std::pair{&this->value_, &rhs.value_}
+            : std::pair{&rhs.value_, &this->value_};
+
+        auto result = __detail::gcdLimbs(
+            __detail::Limbs{lhsValue->begin(), lhsValue->end(), this->value_.resource()},
+            __detail::Limbs{rhsValue->begin(), rhsValue->end(), this->value_.resource()},
+            [](const __detail::LehmerMatrix&) { },
+            [](const __detail::Limb*, std::size_t) { },
+            [](const __detail::HalfGcdMatrix&) { },
+            [] { });
+
+        return fromLimbs(std::move(result), false);
+    }
 
-        if (rhsAbs.equal(0) || lhsAbs.equal(0)) {
-            return 0;
+    /**
+     * @brief Computes the greatest common divisor with the Bezout coefficients.
+     *
+     * @param rhs The right operand.
+     * @return Not negative greatest common divisor g with coefficients x and y such that
+     *         g = x * current + y * rhs, the coefficients are the minimal ones of Euclid's
+     *         algorithm.
+     */
+    [[nodiscard]]
+    std::tuple<BigInteger, BigInteger, BigInteger> gcdExt(const BigInteger& rhs) const {
+        auto swapped = compareMagnitudes(this->value_, rhs.value_) < 0;
+        const auto& lhsAbs = swapped ? rhs.value_ : this->value_;
+        const auto& rhsAbs = swapped ? this->value_ : rhs.value_;
+
+        if (lhsAbs.empty()) {
+            return {BigInteger{}, BigInteger{}, BigInteger{}};
+        }
+
+        // Coefficients of the larger magnitude in the current pair of remainders.
+        BigInteger coefficient{1};
+        BigInteger nextCoefficient;
+        bool halved{};
+
+        auto onMatrix = [&](const __detail::LehmerMatrix& matrix) {
+            BigInteger first;
+            first.addMultiplyAssign(coefficient, matrix.a0);
+            first.addMultiplyAssign(nextCoefficient, matrix.b0);
+
+            BigInteger second;
+            second.addMultiplyAssign(coefficient, matrix.a1);
+            second.addMultiplyAssign(nextCoefficient, matrix.b1);
+
+            coefficient = std::move(first);
+            nextCoefficient = std::move(second);
+        };
+        auto onQuotient = [&](const __detail::Limb* quotient, std::size_t size) {
+            coefficient.subtractMultiplyAssign(fromLimbs(__detail::Limbs(quotient, quotient + size), false), nextCoefficient);
+            std::swap(coefficient, nextCoefficient);
+        };
+        auto onHalf = [&](const __detail::HalfGcdMatrix& matrix) {
+            const auto& [row0, row1] = matrix.entries;
+
+            // The pair is replaced by the inverse (m11, -m01; -m10, m00) applied to it.
+            BigInteger first;
+            first.addMultiplyAssign(coefficient, fromLimbs(row1[1], false));
+            first.subtractMultiplyAssign(nextCoefficient, fromLimbs(row0[1], false));
+
+            BigInteger second;
+            second.addMultiplyAssign(nextCoefficient, fromLimbs(row0[0], false));
+            second.subtractMultiplyAssign(coefficient, fromLimbs(row1[0], false));
+
+            coefficient = std::move(first);
+            nextCoefficient = std::move(second);
+            halved = true;
+        };
+        auto onSwap = [&] {
+            std::swap(coefficient, nextCoefficient);
+        };
+        auto divisor = fromLimbs(__detail::gcdLimbs(lhsAbs, rhsAbs, onMatrix, onQuotient, onHalf, onSwap), false);
+
+        // Half-gcd steps may leave a larger solution, it is taken to the minimal one of Euclid's
+        // algorithm with |coefficient| <= |rhs| / (2 * divisor).
+        if (halved) {
+            auto period = fromLimbs(rhsAbs, false);
+            period.divideAssign(divisor);
+            coefficient.modAssign(period);
+
+            if (coefficient.isNegative()) {
+                coefficient.addAssign(period);
+            }
+            if (coefficient.multiply(2).compare(period) == std::strong_ordering::greater) {
+                coefficient.subtractAssign(period);
+            }
+        }
+
+        // The coefficient of the smaller magnitude follows from the divisor.
+        BigInteger otherCoefficient;
+
+        if (!rhsAbs.empty()) {
+            otherCoefficient = divisor;
+            otherCoefficient.subtractMultiplyAssign(coefficient, fromLimbs(lhsAbs, false));
+            otherCoefficient.divideAssign(fromLimbs(rhsAbs, false));
+        }
+        if (swapped) {
+            std::swap(coefficient, otherCoefficient);
+        }
+        coefficient.setSign(coefficient.isNegative() != this->isNegative());
+        otherCoefficient.setSign(otherCoefficient.isNegative() != rhs.isNegative());
+
+        return {std::move(divisor), std::move(coefficient), std::move(otherCoefficient)};
+    }
+
+    /**
+     * @brief Computes the modular inverse.
+     *
+     * @param modulus Not zero modulus, its sign is ignored.
+     * @return Inverse of the current value in the range [0, |modulus|).
+     */
+    [[nodiscard]]
+    BigInteger modInverse(const BigInteger& modulus) const {
+        if (modulus.value_.empty()) {
+            throw std::invalid_argument("divide by zero");
         }
-        auto remainder{rhsAbs};
+        BigInteger residue{*this, this->get_allocator()};
+        residue.modAssign(modulus);
+
+        auto [divisor, coefficient, unused] = residue.gcdExt(modulus);
 
-        while (!remainder.equal(0)) {
-            remainder = lhsAbs.mod(rhsAbs);
-            lhsAbs = rhsAbs;
-            rhsAbs = remainder;
+        if (!divisor.equal(1)) {
+            throw std::invalid_argument("value is not invertible");
+        }
+        if (coefficient.isNegative()) {
+            coefficient.addSignedAssign(modulus.value_.data(), modulus.value_.size(), false);
         }
-        return lhsAbs;
+        return coefficient;
     }
 
     /**
@@ -689,7 +1241,49 @@ public:
         if (this->equal(0) || rhs.equal(0)) {
             return 0;
         }
-        return this->multiply(rhs).abs().divide(this->gcd(rhs));
+        auto result = this->abs();
+        result.divideAssign(this->gcd(rhs));
+        result.multiplyAssign(rhs.abs());
+
+        return result;
+    }
+
+    /**
+     * @brief Finds the next probable prime.
+     *
+     * Candidates are sieved by the small primes in windows, the rest pass the Baillie-PSW test.
+     *
+     * @return The least probable prime greater than the current value.
+     */
+    [[nodiscard]]
+    BigInteger nextPrime() const {
+        const auto& primes = __detail::smallPrimes;
+
+        if (this->compare(2) == std::strong_ordering::less) {
+            return BigInteger{2, this->get_allocator()};
+        }
+        if (this->compare(primes.back()) == std::strong_ordering::less) {
+            return BigInteger{*std::ranges::upper_bound(primes, this->value_[0]), this->get_allocator()};
+        }
+        auto candidate = this->add((this->value_[0] & 1) != 0 ? 2 : 1);
+        std::array<bool, __detail::primeSieveSize> composite;
+
+        for (;; candidate.addAssign(2 * __detail::primeSieveSize)) {
+            __detail::sievePrimes(composite, candidate.value_.data(), candidate.value_.size());
+
+            for (std::size_t i = 0; i < composite.size(); ++i) {
+                if (composite[i]) {
+                    continue;
+                }
+                auto result = candidate.add(2 * i);
+                const auto data = result.value_.data();
+                const auto size = result.value_.size();
+
+                if (__detail::isStrongProbablePrime(data, size, 2) && __detail::isStrongLucasProbablePrime(data, size)) {
+                    return result;
+                }
+            }
+        }
     }
 
     // Modification and checking -------------------------------------------------------------------
@@ -698,11 +1292,38 @@ public:
      * @brief Checks for current value is power of 10.
      * @return If is power of 10 true otherwise false.
      */
-    bool isPow10() {
-        return (this->value_.at(0) == '1') && std::ranges::all_of(
-            this->value_.cbegin() + 1,
-            this->value_.cend(),
-            [](const auto c) { return c == '0'; });
+    bool isPow10() const {
+        if (this->value_.empty()) {
+            return false;
+        }
+        // 10^k = 5^k * 2^k has k trailing zero bits and k * log2(10) bits rounded up, only the odd
+        // part of such bit length is compared to 5^k. The cached decimal powers are not used, the
+        // product of 10^(19 * 2^level) over the set bits of k / 19 is slower from 30000 digits on.
+        auto zeros = this->trailingZeros();
+        auto bits = static_cast<double>(zeros) * std::log2(10.0);
+
+        if (std::abs(static_cast<double>(this->bitLength()) - bits) > 2.0) {
+            return false;
+        }
+        BigInteger odd{*this, this->get_allocator()};
+        odd.shiftMagnitudeRight(zeros).setSign(false);
+
+        return odd.equal(BigInteger{5}.pow(zeros));
+    }
+
+    /**
+     * @brief Checks for current value is probably prime.
+     *
+     * Trial division by the small primes is followed by the Baillie-PSW test, that is the strong
+     * probable prime test to base 2 and the strong Lucas test, no composite passing it is known.
+     * Extra Miller-Rabin rounds take the small primes as bases.
+     *
+     * @param rounds Count of extra Miller-Rabin rounds.
+     * @return If is probably prime true otherwise false, values less than 2 are not prime.
+     */
+    [[nodiscard]]
+    bool isProbablePrime(std::size_t rounds = 0) const {
+        return !this->isNegative() && __detail::isProbablePrime(this->value_.data(), this->value_.size(), rounds);
     }
 
     /**
@@ -711,7 +1332,11 @@ public:
      */
     [[nodiscard]]
     std::size_t bitLength() const {
-        return to_string(RadixFlag::Binary).length();
+        if (this->value_.empty()) {
+            return 0;
+        }
+        return this->value_.size() * __detail::limbBits -
+            static_cast<std::size_t>(std::countl_zero(this->value_.back()));
     }
 
     /**
@@ -772,30 +1397,25 @@ public:
      * @return Boolean representation of current value.
      */
     explicit operator bool() const {
-        return !this->equal(0);
+        return !this->value_.empty();
     }
 
-public:
-    std::optional<std::int32_t> to_int32() {
-        try {
-            return std::stoi(value_, nullptr, static_cast<int>(radix_.value));
-        } catch (std::invalid_argument&) {
-        } catch (std::out_of_range&) { }
-
-        return std::nullopt;
+    /**
+     * @brief Gets the allocator of limbs.
+     * @return Allocator of limbs.
+     */
+    [[nodiscard]]
+    allocator_type get_allocator() const {
+        return allocator_type{resourceOrDefault(this->value_.resource())};
     }
 
-    std::optional<std::int64_t> to_int64() {
-        try {
-#if defined(__WORDSIZE) && (__WORDSIZE == 64)
-            return std::stol(value_, nullptr, static_cast<int>(radix_.value));
-#else
-            return std::stoll(value_, nullptr, static_cast<int>(radix_.value));
-#endif
-        } catch (std::invalid_argument&) {
-        } catch (std::out_of_range&) { }
+public:
+    std::optional<std::int32_t> to_int32() const {
+        return toIntegral<std::int32_t>();
+    }
 
-        return std::nullopt;
+    std::optional<std::int64_t> to_int64() const {
+        return toIntegral<std::int64_t>();
     }
 
 public:
@@ -807,17 +1427,8 @@ public:
      */
     [[nodiscard]]
     std::string to_string(RadixFlag radix = RadixFlag::Decimal) const {
-        std::stringstream ss;
-
-        if (isNegative()) {
-            ss << '-';
-        }
-        if (radix == RadixFlag::Decimal) {
-            ss << value_;
-        } else {
-            ss << convertFromBaseTen(*this, radix);
-        }
-        return ss.str();
+        auto digits = convertToString(this->value_, radix);
+        return isNegative() ? ('-' + digits) : digits;
     }
 
 private:
@@ -825,45 +1436,338 @@ private:
     static void setDefault(BigInteger& moved) {
         moved.radix_.value = RadixFlag::Decimal;
         moved.sign_.value = SignFlag::positive;
-        moved.value_ = "0";
+        moved.value_.clear();
     }
 
-    // Converts not base ten value to string.
-    static std::string convertFromBaseTen(const BigInteger& value, const RadixFlag radix) {
-        auto decimalValue{value};
-        auto modulo = valueFrom(static_cast<std::uint8_t>(radix));
+    // Adds the product of values taken with the given sign to the current value.
+    BigInteger& multiplyAccumulate(const BigInteger& lhs, const BigInteger& rhs, bool productNegative) {
+        if (lhs.value_.empty() || rhs.value_.empty()) {
+            return *this;
+        }
+        auto longer = &lhs.value_;
+        auto shorter = &rhs.value_;
+
+        if (longer->size() < shorter->size()) {
+            std::swap(longer, shorter);
+        }
 
-        std::string result;
+        // A single limb factor with the sign of the current value is accumulated in place.
+        if (shorter->size() == 1 && (this->value_.empty() || this->isNegative() == productNegative)) {
+            auto factor = shorter->front();
+            auto size = longer->size();
 
-        while (!decimalValue.equal(0)) {
-            auto remainder = decimalValue.mod(modulo);
-            decimalValue = decimalValue.divide(modulo);
+            if (this->value_.size() < size) {
+                this->value_.resize(size);
+            }
+            auto data = this->value_.data();
+            auto carry = __detail::addMultiplyLimb(data, longer->data(), size, factor);
+            carry = __detail::addLimb(data + size, data + size, this->value_.size() - size, carry);
 
-            auto c = baseChars(RadixFlag::Hexadecimal).at(std::stoi(remainder.to_string()));
-            result.push_back(c);
+            if (carry != 0) {
+                this->value_.push_back(carry);
+            }
+            return this->setSign(productNegative);
         }
-        std::ranges::reverse(result);
+        __detail::ScratchLimbs product(longer->size() + shorter->size());
+        __detail::multiply(product.data(), longer->data(), longer->size(), shorter->data(), shorter->size());
+
+        return this->addSignedAssign(
+            product.data(),
+            __detail::trimmedSize(product.data(), product.size()),
+            productNegative);
+    }
+
+    // Creates value from the magnitude and the sign, the magnitude keeps its resource.
+    static BigInteger fromLimbs(__detail::Limbs value, bool negative) {
+        __detail::trim(value);
+
+        BigInteger result{allocator_type{resourceOrDefault(value.resource())}};
+        result.value_ = std::move(value);
+        result.setSign(negative);
 
         return result;
     }
 
-    // Converts string value to base ten.
-    static std::string convertToBaseTen(const std::string& value, RadixFlag radix) {
-        auto last = __detail::charToInt32(value.back());
-        auto length = value.length();
+    // Gets the resource of the allocator, null stands for the global allocator.
+    static std::pmr::memory_resource* resourceOf(const allocator_type& allocator) {
+        auto resource = allocator.resource();
+        return (resource == std::pmr::new_delete_resource()) ? nullptr : resource;
+    }
 
-        auto power = valueFrom(length - 1);
-        auto convertedValue = valueFrom(last);
-        auto radixValue = valueFrom(static_cast<std::uint8_t>(radix));
+    // Gets the resource for the allocator, the global allocator stands for null.
+    static std::pmr::memory_resource* resourceOrDefault(std::pmr::memory_resource* resource) {
+        return (resource == nullptr) ? std::pmr::new_delete_resource() : resource;
+    }
 
-        int current;
+    // Sets the sign, zero is always positive.
+    BigInteger& setSign(bool negative) {
+        this->sign_.value = (negative && !this->value_.empty()) ? SignFlag::negative : SignFlag::positive;
+        return *this;
+    }
+
+    // Adds the magnitude taken with the given sign in the buffer of the current value. The
+    // magnitude may be the one of the current value.
+    BigInteger& addSignedAssign(const __detail::Limb* rhs, std::size_t rhsSize, bool rhsNegative) {
+        // (+a)+(+b) or (-a)+(-b)
+        if (this->isNegative() == rhsNegative) {
+            if (this->value_.size() < rhsSize) {
+                this->value_.resize(rhsSize);
+            }
+            auto size = this->value_.size();
+            auto carry = __detail::addLimbs(this->value_.data(), this->value_.data(), size, rhs, rhsSize);
 
-        for (std::size_t i = 0; i < length - 1; ++i) {
-            current = __detail::charToInt32(value.at(i));
-            convertedValue = convertedValue
-                .add(valueFrom(current).multiply(radixValue.pow(power--)));
+            if (carry != 0) {
+                this->value_.push_back(carry);
+            }
+            return this->setSign(rhsNegative);
         }
-        return std::move(convertedValue.value_);
+
+        // (-a)+(+b) or (+a)+(-b)
+        auto order = __detail::compareLimbs(this->value_.data(), this->value_.size(), rhs, rhsSize);
+
+        if (order >= 0) {
+            auto size = this->value_.size();
+            __detail::subtractLimbs(this->value_.data(), this->value_.data(), size, rhs, rhsSize);
+            __detail::trim(this->value_);
+
+            return this->setSign(this->isNegative());
+        }
+        this->value_.resize(rhsSize);
+        __detail::subtractLimbs(this->value_.data(), rhs, this->value_.data(), rhsSize);
+        __detail::trim(this->value_);
+
+        return this->setSign(rhsNegative);
+    }
+
+    // Applies the operation to limbs of two's complement forms of operands in the buffer of the
+    // current value. The forms are built on the fly: a negative magnitude m takes ~m + 1 and is
+    // extended by ones. The right operand may be the current value.
+    template<typename Operation>
+    BigInteger& bitwiseAssign(const BigInteger& rhs, Operation operation) {
+        const auto negative = operation(this->isNegative(), rhs.isNegative());
+        const auto size = std::max(this->value_.size(), rhs.value_.size()) + 1;
+
+        auto form = [](const BigInteger& value, std::size_t index, __detail::Limb& carry) {
+            auto limb = (index < value.value_.size()) ? value.value_[index] : __detail::Limb{};
+
+            if (value.isPositive()) {
+                return limb;
+            }
+            limb = ~limb + carry;
+            carry &= (limb == 0);
+
+            return limb;
+        };
+        __detail::Limb lhsCarry{1};
+        __detail::Limb rhsCarry{1};
+
+        this->value_.resize(size);
+
+        for (std::size_t i = 0; i < size; ++i) {
+            auto lhsLimb = form(*this, i, lhsCarry);
+            this->value_[i] = operation(lhsLimb, form(rhs, i, rhsCarry));
+        }
+        if (negative) {
+            __detail::negateLimbs(this->value_.data(), size);
+        }
+        __detail::trim(this->value_);
+
+        return this->setSign(negative);
+    }
+
+    // Validates the count of bits to shift on.
+    template<std::integral T>
+    static std::size_t shiftCount(T count) {
+        if (std::cmp_less(count, 0)) {
+            throw std::invalid_argument{"negative value"};
+        }
+        if (std::cmp_greater(count, std::numeric_limits<std::size_t>::max())) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+        return static_cast<std::size_t>(count);
+    }
+
+    // Validates the count of bits to shift on, too large count is saturated.
+    static std::size_t shiftCount(const BigInteger& count) {
+        if (count.isNegative()) {
+            throw std::invalid_argument{"negative value"};
+        }
+        if (count.value_.empty()) {
+            return 0;
+        }
+        return (count.value_.size() > 1) ? std::numeric_limits<std::size_t>::max() : shiftCount(count.value_.front());
+    }
+
+    // Shifts the magnitude to left by moving limbs and shifting them within limbs once.
+    BigInteger& shiftMagnitudeLeft(std::size_t count) {
+        if (this->value_.empty() || count == 0) {
+            return *this;
+        }
+        auto limbs = count / __detail::limbBits;
+        auto bits = static_cast<unsigned>(count % __detail::limbBits);
+        auto size = this->value_.size();
+
+        this->value_.resize(size + limbs + 1);
+        auto data = this->value_.data();
+
+        if (bits != 0) {
+            data[size + limbs] = __detail::shiftLeftLimbs(data + limbs, data, size, bits);
+        } else {
+            std::copy_backward(data, data + size, data + size + limbs);
+            data[size + limbs] = 0;
+        }
+        std::fill(data, data + limbs, __detail::Limb{});
+        __detail::trim(this->value_);
+
+        return *this;
+    }
+
+    // Shifts the magnitude to right by moving limbs and shifting them within limbs once.
+    BigInteger& shiftMagnitudeRight(std::size_t count) {
+        auto limbs = count / __detail::limbBits;
+        auto bits = static_cast<unsigned>(count % __detail::limbBits);
+
+        if (limbs >= this->value_.size()) {
+            this->value_.clear();
+            this->sign_.value = SignFlag::positive;
+
+            return *this;
+        }
+        auto size = this->value_.size() - limbs;
+        auto data = this->value_.data();
+
+        if (bits != 0) {
+            __detail::shiftRightLimbs(data, data + limbs, size, bits);
+        } else {
+            std::copy(data + limbs, data + limbs + size, data);
+        }
+        this->value_.resize(size);
+        __detail::trim(this->value_);
+
+        if (this->value_.empty()) {
+            this->sign_.value = SignFlag::positive;
+        }
+        return *this;
+    }
+
+    // Gets the count of trailing zero bits of the not zero magnitude.
+    [[nodiscard]]
+    std::size_t trailingZeros() const {
+        std::size_t zeros{};
+
+        while (this->value_[zeros / __detail::limbBits] == 0) {
+            zeros += __detail::limbBits;
+        }
+        return zeros + static_cast<std::size_t>(std::countr_zero(this->value_[zeros / __detail::limbBits]));
+    }
+
+    // Raises the not zero value to the not zero power of the trimmed exponent. The odd part of the
+    // magnitude is raised by sliding windows of its odd powers, the power of two is a shift.
+    BigInteger powMagnitude(const __detail::Limb* exponent, std::size_t exponentSize) const {
+        auto zeros = this->trailingZeros();
+
+        BigInteger odd{*this, this->get_allocator()};
+        odd.shiftMagnitudeRight(zeros).setSign(false);
+
+        BigInteger result{1, this->get_allocator()};
+
+        if (!odd.equal(1) || zeros != 0) {
+            const auto limit = std::numeric_limits<std::size_t>::max() / std::max<std::size_t>(zeros, 1);
+
+            if (exponentSize > 1 || exponent[0] > limit) {
+                throw std::length_error{"power is too long"};
+            }
+        }
+        if (!odd.equal(1)) {
+            auto bits = __detail::limbBits - static_cast<std::size_t>(std::countl_zero(exponent[0]));
+            auto window = __detail::powerWindowBits(bits);
+
+            // Odd powers odd^1, odd^3, ..., odd^(2^window - 1).
+            std::array<BigInteger, 32> table;
+            table[0] = odd;
+
+            if (window > 1) {
+                auto square = odd.square();
+
+                for (std::size_t i = 1; i < (std::size_t{1} << (window - 1)); ++i) {
+                    table[i] = table[i - 1].multiply(square);
+                }
+            }
+            __detail::scanWindows(exponent, 1, window, [&](std::size_t digit, std::size_t squarings) {
+                for (std::size_t i = 0; i < squarings; ++i) {
+                    result = result.square();
+                }
+                if (digit != 0) {
+                    result.multiplyAssign(table[digit / 2]);
+                }
+            });
+        }
+        result.shiftMagnitudeLeft(zeros * static_cast<std::size_t>(exponent[0]));
+
+        result.setSign(this->isNegative() && (exponent[0] & 1) != 0);
+
+        return result;
+    }
+
+    // Converts to signed integral value if it fits.
+    template<std::signed_integral T>
+    [[nodiscard]]
+    std::optional<T> toIntegral() const {
+        using UnsignedType = std::make_unsigned_t<T>;
+
+        if (this->value_.size() > 1) {
+            return std::nullopt;
+        }
+        auto magnitude = this->value_.empty() ? __detail::Limb{} : this->value_.front();
+        auto limit = static_cast<__detail::Limb>(std::numeric_limits<T>::max()) + (isNegative() ? 1 : 0);
+
+        if (magnitude > limit) {
+            return std::nullopt;
+        }
+        auto value = static_cast<UnsignedType>(magnitude);
+        return static_cast<T>(isNegative() ? static_cast<UnsignedType>(UnsignedType{} - value) : value);
+    }
+
+    // Three way compares magnitudes, returns -1, 0 or 1.
+    static int compareMagnitudes(const __detail::Limbs& lhs, const __detail::Limbs& rhs) {
+        return __detail::compareLimbs(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    }
+
+    // Multiplies magnitudes.
+    static __detail::Limbs multiplyMagnitudes(const __detail::Limbs& lhs, const __detail::Limbs& rhs) {
+        if (lhs.empty() || rhs.empty()) {
+            return {};
+        }
+        __detail::Limbs result(lhs.size() + rhs.size(), lhs.resource());
+        __detail::multiply(result.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+
+        return result;
+    }
+
+    // Divides magnitudes into the quotient and the remainder, the divisor must not be zero.
+    static std::pair<__detail::Limbs, __detail::Limbs> divideMagnitudes(
+        const __detail::Limbs& lhs,
+        const __detail::Limbs& rhs)
+    {
+        if (compareMagnitudes(lhs, rhs) < 0) {
+            return {__detail::Limbs{lhs.resource()}, __detail::Limbs{lhs.begin(), lhs.end(), lhs.resource()}};
+        }
+        __detail::Limbs quotient(lhs.size() - rhs.size() + 1, lhs.resource());
+        __detail::Limbs remainder(rhs.size(), lhs.resource());
+
+        __detail::divide(quotient.data(), remainder.data(), lhs.data(), lhs.size(), rhs.data(), rhs.size());
+
+        return {std::move(quotient), std::move(remainder)};
+    }
+
+    // Converts the magnitude to string.
+    static std::string convertToString(const __detail::Limbs& value, const RadixFlag radix) {
+        return __detail::toDigits(value.data(), value.size(), radix);
+    }
+
+    // Converts the valid string without sign to magnitude.
+    static __detail::Limbs convertFromString(const std::string& value, RadixFlag radix) {
+        return __detail::fromDigits(value, radix);
     }
 };
 
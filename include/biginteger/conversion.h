@@ -0,0 +1,316 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_CONVERSION_H
+#define ALEF_NUMERICS_BIGINTEGER_CONVERSION_H
+
+#include "division.h"
+#include "limb.h"
+#include "multiplication.h"
+#include "radix.h"
+#include "scratch.h"
+#include "utility.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// Size in limbs from which radix conversion splits the value by powers of the radix.
+#ifndef WINGMANN_BIGINTEGER_CONVERSION_THRESHOLD
+#define WINGMANN_BIGINTEGER_CONVERSION_THRESHOLD 40
+#endif
+
+namespace wingmann::numerics::__detail {
+
+static constexpr std::size_t conversionThreshold = WINGMANN_BIGINTEGER_CONVERSION_THRESHOLD;
+
+static_assert(conversionThreshold >= 1, "conversion threshold is too small");
+
+// Gets the count of digits fitting into a limb and the radix raised to the power of this count.
+static constexpr std::pair<std::size_t, Limb> limbDigits(RadixFlag radix) {
+    auto base = static_cast<Limb>(radix);
+    auto power{base};
+    std::size_t count{1};
+
+    while (power <= std::numeric_limits<Limb>::max() / base) {
+        power *= base;
+        ++count;
+    }
+    return {count, power};
+}
+
+// Gets the count of bits per digit of the power of two radix, zero for other radices.
+static constexpr unsigned radixBits(RadixFlag radix) {
+    auto base = static_cast<unsigned>(radix);
+    return std::has_single_bit(base) ? static_cast<unsigned>(std::countr_zero(base)) : 0;
+}
+
+// Powers of the radix shared by the conversions of all threads, the power of the level takes
+// (count << level) digits, where count is the count of digits fitting into a limb. Powers are
+// appended by squaring under the lock and never changed, so published ones are read without it.
+class RadixPowers {
+    // The power of the level takes at least 2^level limbs.
+    static constexpr std::size_t maxLevels = limbBits;
+
+    RadixFlag radix_;
+    std::array<Limbs, maxLevels> powers_;
+    std::atomic<std::size_t> size_{};
+    std::mutex mutex_;
+
+public:
+    explicit RadixPowers(RadixFlag radix) : radix_{radix} { }
+
+    RadixPowers(const RadixPowers&) = delete;
+    RadixPowers& operator=(const RadixPowers&) = delete;
+
+    // Gets the powers of the radix. Radices of powers of two are converted by bits without powers,
+    // so the decimal one is the only radix having the table.
+    static RadixPowers& of(RadixFlag radix) {
+        if (radixBits(radix) != 0) {
+            throw std::invalid_argument{"radix of a power of two has no powers"};
+        }
+        static RadixPowers decimal{RadixFlag::Decimal};
+        return decimal;
+    }
+
+    // Gets the power of the level, the powers are grown up to it.
+    const Limbs& operator[](std::size_t level) {
+        if (level >= size_.load(std::memory_order_acquire)) {
+            grow(level);
+        }
+        return powers_[level];
+    }
+
+private:
+    // Appends squares to the powers until the level is present.
+    void grow(std::size_t level) {
+        if (level >= maxLevels) {
+            throw std::length_error{"radix power is too long"};
+        }
+        std::lock_guard lock{mutex_};
+        auto size = size_.load(std::memory_order_relaxed);
+
+        if (size == 0) {
+            powers_[0] = Limbs{limbDigits(radix_).second};
+            size_.store(++size, std::memory_order_release);
+        }
+        for (; size <= level; size_.store(++size, std::memory_order_release)) {
+            const auto& last = powers_[size - 1];
+
+            Limbs square(2 * last.size());
+            multiply(square.data(), last.data(), last.size(), last.data(), last.size());
+            trim(square);
+
+            powers_[size] = std::move(square);
+        }
+    }
+};
+
+// Writes digits of the value backward from the end chunk by chunk, the buffer must be filled
+// with zero digits and take all digits of the value.
+static inline void toDigitsBasecase(char* end, const Limb* value, std::size_t size, RadixFlag radix) {
+    const auto [count, power] = limbDigits(radix);
+    const auto base = static_cast<Limb>(radix);
+    const auto chars = baseChars(RadixFlag::Hexadecimal);
+
+    ScratchLimbs quotient(value, value + size);
+
+    while (size > 0) {
+        auto chunk = divideLimb(quotient.data(), quotient.data(), size, power);
+        size = trimmedSize(quotient.data(), size);
+
+        for (auto position = end; chunk != 0; chunk /= base) {
+            *--position = chars[chunk % base];
+        }
+        end -= count;
+    }
+}
+
+// Converts not empty magnitude to digits of the power of two radix by bit extraction.
+static inline std::string toDigitsPowerOfTwo(const Limb* value, std::size_t size, unsigned bits) {
+    const auto chars = baseChars(RadixFlag::Hexadecimal);
+    const auto mask = (Limb{1} << bits) - 1;
+
+    auto bitLength = size * limbBits - static_cast<std::size_t>(std::countl_zero(value[size - 1]));
+    std::string result((bitLength + bits - 1) / bits, '0');
+
+    std::size_t position{};
+
+    for (auto i = result.length(); i-- > 0; position += bits) {
+        auto index = position / limbBits;
+        auto offset = static_cast<unsigned>(position % limbBits);
+        auto digit = value[index] >> offset;
+
+        if ((offset + bits > limbBits) && (index + 1 < size)) {
+            digit |= value[index + 1] << (limbBits - offset);
+        }
+        result[i] = chars[digit & mask];
+    }
+    return result;
+}
+
+// Writes (count << level) digits of the value less than the power of the level backward from
+// the end. The buffer must be filled with zero digits.
+static void toDigits(
+    char* end,
+    std::size_t level,
+    const Limb* value,
+    std::size_t size,
+    RadixPowers& powers,
+    RadixFlag radix)
+{
+    if (level == 0 || size < conversionThreshold) {
+        toDigitsBasecase(end, value, size, radix);
+        return;
+    }
+    const auto& power = powers[level - 1];
+    const auto half = limbDigits(radix).first << (level - 1);
+
+    if (compareLimbs(value, size, power.data(), power.size()) < 0) {
+        toDigits(end, level - 1, value, size, powers, radix);
+        return;
+    }
+    ScratchLimbs quotient(size - power.size() + 1);
+    ScratchLimbs remainder(power.size());
+
+    divide(quotient.data(), remainder.data(), value, size, power.data(), power.size());
+
+    toDigits(end, level - 1, remainder.data(), trimmedSize(remainder.data(), remainder.size()), powers, radix);
+    toDigits(end - half, level - 1, quotient.data(), trimmedSize(quotient.data(), quotient.size()), powers, radix);
+}
+
+// Converts the magnitude to digits. Large values are split by the power of the radix into
+// halves converted recursively, so the conversion follows the division cost.
+static std::string toDigits(const Limb* value, std::size_t size, RadixFlag radix) {
+    if (size == 0) {
+        return "0";
+    }
+    if (auto bits = radixBits(radix); bits != 0) {
+        return toDigitsPowerOfTwo(value, size, bits);
+    }
+    const auto count = limbDigits(radix).first;
+
+    auto& powers = RadixPowers::of(radix);
+    std::size_t length;
+    std::size_t level{};
+
+    if (size < conversionThreshold) {
+        // Every radix takes at least 60 bits per chunk.
+        length = count * (size + size / 15 + 1);
+    } else {
+        while (powers[level].size() <= size) {
+            ++level;
+        }
+        length = count << level;
+    }
+    std::string result(length, '0');
+    toDigits(result.data() + result.size(), level, value, size, powers, radix);
+
+    result.erase(0, std::min(result.find_first_not_of('0'), result.size() - 1));
+
+    return result;
+}
+
+// Converts valid digits without sign to the magnitude chunk by chunk.
+static inline Limbs fromDigitsBasecase(const char* digits, std::size_t length, RadixFlag radix) {
+    const auto [count, power] = limbDigits(radix);
+    const auto base = static_cast<Limb>(radix);
+
+    Limbs result;
+    result.reserve(length / count + 1);
+
+    auto chunkLength = (length % count == 0) ? count : (length % count);
+
+    for (std::size_t position = 0; position < length; position += chunkLength, chunkLength = count) {
+        Limb chunk{};
+        Limb scale{1};
+
+        for (std::size_t i = 0; i < chunkLength; ++i) {
+            chunk = chunk * base + static_cast<Limb>(charToInt32(digits[position + i]));
+            scale *= base;
+        }
+        auto carry = multiplyLimb(result.data(), result.data(), result.size(), scale);
+        carry += addLimb(result.data(), result.data(), result.size(), chunk);
+
+        if (carry != 0) {
+            result.push_back(carry);
+        }
+    }
+    trim(result);
+
+    return result;
+}
+
+// Converts valid digits without sign of the power of two radix to the magnitude by bit packing.
+static inline Limbs fromDigitsPowerOfTwo(const char* digits, std::size_t length, unsigned bits) {
+    Limbs result((length * bits + limbBits - 1) / limbBits);
+
+    Limb accumulator{};
+    unsigned filled{};
+    std::size_t index{};
+
+    for (auto i = length; i-- > 0;) {
+        auto digit = static_cast<Limb>(charToInt32(digits[i]));
+
+        accumulator |= digit << filled;
+        filled += bits;
+
+        if (filled >= limbBits) {
+            result[index++] = accumulator;
+            filled -= limbBits;
+            accumulator = (filled != 0) ? (digit >> (bits - filled)) : Limb{};
+        }
+    }
+    if (filled != 0) {
+        result[index] = accumulator;
+    }
+    trim(result);
+
+    return result;
+}
+
+// Converts valid digits without sign to the magnitude. Long digit strings are split at
+// (count << level) low digits, both parts are converted recursively and joined by the power.
+static Limbs fromDigits(const char* digits, std::size_t length, RadixFlag radix, RadixPowers& powers) {
+    const auto count = limbDigits(radix).first;
+
+    if (length < count * conversionThreshold) {
+        return fromDigitsBasecase(digits, length, radix);
+    }
+    std::size_t level{};
+
+    while ((count << (level + 1)) < length) {
+        ++level;
+    }
+    const auto lowLength = count << level;
+
+    auto high = fromDigits(digits, length - lowLength, radix, powers);
+    auto low = fromDigits(digits + length - lowLength, lowLength, radix, powers);
+
+    if (high.empty()) {
+        return low;
+    }
+    const auto& power = powers[level];
+    Limbs result(high.size() + power.size());
+
+    multiply(result.data(), high.data(), high.size(), power.data(), power.size());
+    addLimbs(result.data(), result.data(), result.size(), low.data(), low.size());
+    trim(result);
+
+    return result;
+}
+
+// Converts valid digits without sign to the magnitude.
+static Limbs fromDigits(const std::string& digits, RadixFlag radix) {
+    if (auto bits = radixBits(radix); bits != 0) {
+        return fromDigitsPowerOfTwo(digits.data(), digits.length(), bits);
+    }
+    return fromDigits(digits.data(), digits.length(), radix, RadixPowers::of(radix));
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_CONVERSION_H
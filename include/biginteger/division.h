@@ -0,0 +1,179 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_DIVISION_H
+#define ALEF_NUMERICS_BIGINTEGER_DIVISION_H
+
+#include "limb.h"
+#include "multiplication.h"
+#include "scratch.h"
+
+#include <algorithm>
+
+// Divisor size in limbs from which recursive (Burnikel-Ziegler) division is used.
+#ifndef WINGMANN_BIGINTEGER_DIVIDE_THRESHOLD
+#define WINGMANN_BIGINTEGER_DIVIDE_THRESHOLD 60
+#endif
+
+namespace wingmann::numerics::__detail {
+
+static constexpr std::size_t divideThreshold = WINGMANN_BIGINTEGER_DIVIDE_THRESHOLD;
+
+static_assert(divideThreshold >= 4, "division threshold is too small");
+
+// Knuth's algorithm D. The divisor is normalized and takes at least two limbs, the high
+// divisorSize limbs of the numerator must be less than the divisor. The quotient takes
+// numeratorSize - divisorSize limbs, the remainder replaces the low divisorSize limbs
+// of the numerator and the high limbs are zeroed.
+static inline void divideSchoolbook(
+    Limb* quotient,
+    Limb* numerator,
+    std::size_t numeratorSize,
+    const Limb* divisor,
+    std::size_t divisorSize)
+{
+    const auto divisorHigh = divisor[divisorSize - 1];
+    const auto divisorLow = divisor[divisorSize - 2];
+    const auto reciprocal = reciprocalLimb(divisorHigh);
+
+    for (auto j = numeratorSize - divisorSize; j-- > 0;) {
+        auto top = numerator + j + divisorSize;
+        Limb digit;
+        Limb rest;
+        bool refine{true};
+
+        if (top[0] >= divisorHigh) {
+            digit = ~Limb{};
+            rest = top[-1] + divisorHigh;
+            refine = rest >= divisorHigh;
+        } else {
+            digit = divideLimbs(top[0], top[-1], divisorHigh, reciprocal, rest);
+        }
+
+        // Refines the estimate with the second divisor limb, then it is at most one too large.
+        if (refine) {
+            Limb productHigh;
+            Limb productLow = multiplyLimbs(digit, divisorLow, productHigh);
+
+            while (productHigh > rest || (productHigh == rest && productLow > top[-2])) {
+                --digit;
+                rest += divisorHigh;
+
+                if (rest < divisorHigh) {
+                    break;
+                }
+                productHigh -= productLow < divisorLow;
+                productLow -= divisorLow;
+            }
+        }
+        auto borrow = subtractMultiplyLimb(numerator + j, divisor, divisorSize, digit);
+
+        if (top[0] < borrow) {
+            --digit;
+            addLimbs(numerator + j, numerator + j, divisor, divisorSize);
+        }
+        top[0] = 0;
+        quotient[j] = digit;
+    }
+}
+
+// Recursive division of Burnikel and Ziegler. The numerator takes size + count limbs, its high
+// size limbs must be less than the normalized divisor, count must not exceed size. The quotient
+// takes count limbs, the remainder replaces the low size limbs of the numerator and the high
+// limbs are zeroed. The scratch takes size limbs.
+static void divideRecursive(
+    Limb* quotient,
+    Limb* numerator,
+    std::size_t count,
+    const Limb* divisor,
+    std::size_t size,
+    Limb* scratch)
+{
+    if (count < divideThreshold) {
+        divideSchoolbook(quotient, numerator, size + count, divisor, size);
+        return;
+    }
+    if (count == size) {
+        auto low = size / 2;
+        auto high = size - low;
+
+        divideRecursive(quotient + low, numerator + low, high, divisor, size, scratch);
+        divideRecursive(quotient, numerator, low, divisor, size, scratch);
+        return;
+    }
+
+    // Estimates the quotient by the high count limbs of the divisor, it is at most two too large.
+    auto numeratorHigh = numerator + size - count;
+    auto divisorHigh = divisor + size - count;
+
+    if (compareLimbs(numeratorHigh + count, divisorHigh, count) < 0) {
+        divideRecursive(quotient, numeratorHigh, count, divisorHigh, count, scratch);
+    } else {
+        std::fill(quotient, quotient + count, ~Limb{});
+
+        subtractLimbs(numeratorHigh + count, numeratorHigh + count, divisorHigh, count);
+        numeratorHigh[count] = addLimbs(numeratorHigh, numeratorHigh, divisorHigh, count);
+    }
+    multiply(scratch, quotient, count, divisor, size - count);
+    numerator[size] -= subtractLimbs(numerator, numerator, scratch, size);
+
+    while (numerator[size] != 0) {
+        subtractLimb(quotient, quotient, count, 1);
+        numerator[size] += addLimbs(numerator, numerator, divisor, size);
+    }
+}
+
+// Divides lhs by rhs with not zero high limb, lhsSize must not be less than rhsSize. The quotient
+// takes lhsSize - rhsSize + 1 limbs and the remainder takes rhsSize limbs.
+static void divide(
+    Limb* quotient,
+    Limb* remainder,
+    const Limb* lhs,
+    std::size_t lhsSize,
+    const Limb* rhs,
+    std::size_t rhsSize)
+{
+    if (rhsSize == 1) {
+        remainder[0] = divideLimb(quotient, lhs, lhsSize, rhs[0]);
+        return;
+    }
+    auto shift = static_cast<unsigned>(std::countl_zero(rhs[rhsSize - 1]));
+
+    ScratchLimbs numerator(lhsSize + 1);
+    ScratchLimbs divisor(rhs, rhs + rhsSize);
+
+    if (shift != 0) {
+        shiftLeftLimbs(divisor.data(), divisor.data(), rhsSize, shift);
+        numerator[lhsSize] = shiftLeftLimbs(numerator.data(), lhs, lhsSize, shift);
+    } else {
+        std::copy(lhs, lhs + lhsSize, numerator.begin());
+    }
+    if (rhsSize < divideThreshold) {
+        divideSchoolbook(quotient, numerator.data(), lhsSize + 1, divisor.data(), rhsSize);
+    } else {
+        ScratchLimbs scratch(rhsSize);
+
+        // Takes quotient blocks of the divisor size from the top, the highest block is partial.
+        auto position = lhsSize + 1 - rhsSize;
+
+        while (position != 0) {
+            auto count = (position % rhsSize != 0) ? (position % rhsSize) : rhsSize;
+            position -= count;
+
+            divideRecursive(
+                quotient + position,
+                numerator.data() + position,
+                count,
+                divisor.data(),
+                rhsSize,
+                scratch.data());
+        }
+    }
+
+    if (shift != 0) {
+        shiftRightLimbs(remainder, numerator.data(), rhsSize, shift);
+    } else {
+        std::copy(numerator.begin(), numerator.begin() + rhsSize, remainder);
+    }
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_DIVISION_H
@@ -0,0 +1,300 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_EXPRESSION_H
+#define ALEF_NUMERICS_BIGINTEGER_EXPRESSION_H
+
+#include "bigInteger.h"
+
+// Opt-in lazy arithmetic. An operand wrapped by lazy() makes the product an expression evaluated
+// by fused kernels when it is added, subtracted or reduced, so the full size product is never a
+// value of its own:
+//
+//     result += lazy(a) * b;           // addMultiplyAssign
+//     result = c - lazy(x) * q;        // subtractMultiplyAssign
+//     result = lazy(a) * b % m;        // multiplyMod
+//
+// Assigned sums are evaluated in the buffer of the destination, in place when the destination is
+// the addend. Expressions keep references to the operands and must be evaluated while the
+// operands live.
+
+namespace wingmann::numerics {
+
+/**
+ * @brief Operand of the lazily evaluated product.
+ */
+class LazyValue {
+    const BigInteger& value_;
+
+public:
+    explicit LazyValue(const BigInteger& value) : value_{value} { }
+
+    [[nodiscard]]
+    const BigInteger& value() const { return value_; }
+};
+
+/**
+ * @brief Wraps the operand to build lazily evaluated expressions.
+ *
+ * @param value The operand.
+ * @return Lazy operand.
+ */
+static LazyValue lazy(const BigInteger& value) {
+    return LazyValue{value};
+}
+
+/**
+ * @brief Product of two values.
+ */
+class ProductExpression {
+    const BigInteger& lhs_;
+    const BigInteger& rhs_;
+
+public:
+    ProductExpression(const BigInteger& lhs, const BigInteger& rhs) : lhs_{lhs}, rhs_{rhs} { }
+
+    /**
+     * @brief Adds the product to the destination.
+     *
+     * @param destination The value to which to add the product.
+     * @return Modified destination.
+     */
+    BigInteger& addTo(BigInteger& destination) const {
+        return destination.addMultiplyAssign(lhs_, rhs_);
+    }
+
+    /**
+     * @brief Subtracts the product from the destination.
+     *
+     * @param destination The value from which to subtract the product.
+     * @return Modified destination.
+     */
+    BigInteger& subtractFrom(BigInteger& destination) const {
+        return destination.subtractMultiplyAssign(lhs_, rhs_);
+    }
+
+    /**
+     * @brief Computes the remainder of the product by the modulus.
+     *
+     * @param modulus The divisor of the product.
+     * @return Remainder of the product.
+     */
+    [[nodiscard]]
+    BigInteger mod(const BigInteger& modulus) const {
+        return lhs_.multiplyMod(rhs_, modulus);
+    }
+
+    /**
+     * @brief Checks for the value is an operand of the product.
+     *
+     * @param value The value to check.
+     * @return If the value is an operand true otherwise false.
+     */
+    [[nodiscard]]
+    bool uses(const BigInteger& value) const {
+        return &lhs_ == &value || &rhs_ == &value;
+    }
+
+    /**
+     * @brief Evaluates the product.
+     */
+    operator BigInteger() const {
+        return lhs_.multiply(rhs_);
+    }
+};
+
+/**
+ * @brief Sum of the value and the product taken with signs.
+ */
+class SumExpression {
+    const BigInteger& addend_;
+    ProductExpression product_;
+    bool subtract_;
+    bool negate_;
+
+public:
+    SumExpression(const BigInteger& addend, const ProductExpression& product, bool subtract, bool negate)
+        : addend_{addend},
+          product_{product},
+          subtract_{subtract},
+          negate_{negate}
+    {
+    }
+
+    /**
+     * @brief Evaluates the sum into the destination, its buffer is reused.
+     *
+     * The addend is copied into the destination unless it is the destination itself, then the
+     * product is added in place by the single fused operation.
+     *
+     * @param destination The value to which to write the sum.
+     * @return Modified destination.
+     */
+    BigInteger& evaluateInto(BigInteger& destination) const {
+        if (&destination != &addend_) {
+            // The operand of the product would be overwritten by the addend.
+            if (product_.uses(destination)) {
+                return destination = static_cast<BigInteger>(*this);
+            }
+            destination = addend_;
+        }
+        return accumulate(destination);
+    }
+
+    /**
+     * @brief Evaluates the sum by the single fused operation.
+     */
+    operator BigInteger() const {
+        BigInteger result{addend_, addend_.get_allocator()};
+        accumulate(result);
+
+        return result;
+    }
+
+private:
+    // Adds the product taken with the sign to the addend copied into the destination.
+    BigInteger& accumulate(BigInteger& destination) const {
+        if (subtract_) {
+            product_.subtractFrom(destination);
+        } else {
+            product_.addTo(destination);
+        }
+        if (negate_) {
+            destination.negateAssign();
+        }
+        return destination;
+    }
+};
+
+/**
+ * @brief Remainder of the product by the modulus.
+ */
+class ModExpression {
+    ProductExpression product_;
+    const BigInteger& modulus_;
+
+public:
+    ModExpression(const ProductExpression& product, const BigInteger& modulus)
+        : product_{product},
+          modulus_{modulus}
+    {
+    }
+
+    /**
+     * @brief Evaluates the remainder.
+     */
+    operator BigInteger() const {
+        return product_.mod(modulus_);
+    }
+};
+
+/**
+ * @brief Builds the product expression.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Product expression.
+ */
+static ProductExpression operator*(const LazyValue& lhs, const BigInteger& rhs) {
+    return {lhs.value(), rhs};
+}
+
+/**
+ * @brief Builds the product expression.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Product expression.
+ */
+static ProductExpression operator*(const BigInteger& lhs, const LazyValue& rhs) {
+    return {lhs, rhs.value()};
+}
+
+/**
+ * @brief Builds the product expression.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Product expression.
+ */
+static ProductExpression operator*(const LazyValue& lhs, const LazyValue& rhs) {
+    return {lhs.value(), rhs.value()};
+}
+
+/**
+ * @brief Builds the expression of the product plus the value.
+ *
+ * @param lhs The product.
+ * @param rhs The value.
+ * @return    Sum expression.
+ */
+static SumExpression operator+(const ProductExpression& lhs, const BigInteger& rhs) {
+    return {rhs, lhs, false, false};
+}
+
+/**
+ * @brief Builds the expression of the value plus the product.
+ *
+ * @param lhs The value.
+ * @param rhs The product.
+ * @return    Sum expression.
+ */
+static SumExpression operator+(const BigInteger& lhs, const ProductExpression& rhs) {
+    return {lhs, rhs, false, false};
+}
+
+/**
+ * @brief Builds the expression of the value minus the product.
+ *
+ * @param lhs The value.
+ * @param rhs The product.
+ * @return    Sum expression.
+ */
+static SumExpression operator-(const BigInteger& lhs, const ProductExpression& rhs) {
+    return {lhs, rhs, true, false};
+}
+
+/**
+ * @brief Builds the expression of the product minus the value.
+ *
+ * @param lhs The product.
+ * @param rhs The value.
+ * @return    Sum expression.
+ */
+static SumExpression operator-(const ProductExpression& lhs, const BigInteger& rhs) {
+    return {rhs, lhs, true, true};
+}
+
+/**
+ * @brief Builds the expression of the remainder of the product.
+ *
+ * @param lhs The product.
+ * @param rhs The modulus.
+ * @return    Remainder expression.
+ */
+static ModExpression operator%(const ProductExpression& lhs, const BigInteger& rhs) {
+    return {lhs, rhs};
+}
+
+/**
+ * @brief Adds the product to the value by the fused kernel.
+ *
+ * @param lhs The value.
+ * @param rhs The product.
+ * @return    Modified value.
+ */
+static BigInteger& operator+=(BigInteger& lhs, const ProductExpression& rhs) {
+    return rhs.addTo(lhs);
+}
+
+/**
+ * @brief Subtracts the product from the value by the fused kernel.
+ *
+ * @param lhs The value.
+ * @param rhs The product.
+ * @return    Modified value.
+ */
+static BigInteger& operator-=(BigInteger& lhs, const ProductExpression& rhs) {
+    return rhs.subtractFrom(lhs);
+}
+
+} // namespace wingmann::numerics
+
+#endif // ALEF_NUMERICS_BIGINTEGER_EXPRESSION_H
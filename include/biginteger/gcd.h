@@ -0,0 +1,636 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_GCD_H
+#define ALEF_NUMERICS_BIGINTEGER_GCD_H
+
+#include "division.h"
+#include "limb.h"
+#include "multiplication.h"
+#include "scratch.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+// Size in limbs from which the half-gcd reduction recurses instead of taking Lehmer steps.
+#ifndef WINGMANN_BIGINTEGER_HALF_GCD_THRESHOLD
+#define WINGMANN_BIGINTEGER_HALF_GCD_THRESHOLD 60
+#endif
+
+// Size in limbs from which the greatest common divisor is reduced by half-gcd steps.
+#ifndef WINGMANN_BIGINTEGER_GCD_THRESHOLD
+#define WINGMANN_BIGINTEGER_GCD_THRESHOLD 120
+#endif
+
+namespace wingmann::numerics::__detail {
+
+static constexpr std::size_t halfGcdThreshold = WINGMANN_BIGINTEGER_HALF_GCD_THRESHOLD;
+static constexpr std::size_t gcdThreshold = WINGMANN_BIGINTEGER_GCD_THRESHOLD;
+
+static_assert(halfGcdThreshold >= 4, "half-gcd threshold is too small");
+static_assert(gcdThreshold >= 4, "gcd threshold is too small");
+
+// Count of leading bits taken by a step of Lehmer's algorithm, the cofactors fit into int64.
+static constexpr unsigned lehmerBits = 62;
+
+// Cofactors of a Lehmer step, the pair (a, b) becomes (a0 * a + b0 * b, a1 * a + b1 * b).
+struct LehmerMatrix {
+    std::int64_t a0{1};
+    std::int64_t b0{};
+    std::int64_t a1{};
+    std::int64_t b1{1};
+};
+
+// Gets 64 bits of the value starting from the bit position.
+static inline Limb bitsAt(const Limb* value, std::size_t size, std::size_t position) {
+    auto index = position / limbBits;
+    auto offset = static_cast<unsigned>(position % limbBits);
+
+    if (index >= size) {
+        return 0;
+    }
+    auto bits = value[index] >> offset;
+
+    if (offset != 0 && index + 1 < size) {
+        bits |= value[index + 1] << (limbBits - offset);
+    }
+    return bits;
+}
+
+// Simulates Euclid's algorithm on the leading bits of a >= b (Knuth's algorithm L), the steps
+// are taken while the quotients of both bounds of the leading bits agree. Returns false if no
+// step is certain.
+static inline bool lehmerMatrix(Limb aHigh, Limb bHigh, LehmerMatrix& matrix) {
+    auto x = static_cast<std::int64_t>(aHigh);
+    auto y = static_cast<std::int64_t>(bHigh);
+
+    matrix = LehmerMatrix{};
+
+    while (y + matrix.a1 > 0 && y + matrix.b1 > 0) {
+        auto quotient = (x + matrix.a0) / (y + matrix.a1);
+
+        if (quotient != (x + matrix.b0) / (y + matrix.b1)) {
+            break;
+        }
+        matrix = {matrix.a1, matrix.b1, matrix.a0 - quotient * matrix.a1, matrix.b0 - quotient * matrix.b1};
+        x = std::exchange(y, x - quotient * y);
+    }
+    return matrix.b0 != 0;
+}
+
+// Computes x * a + y * b for cofactors of a Lehmer row, the result is known not to be negative.
+// The value b must not be longer than a.
+static inline void combineLimbs(Limbs& result, const Limbs& a, const Limbs& b, std::int64_t x, std::int64_t y) {
+    const auto& [positive, positiveFactor, negative, negativeFactor] = (y > 0)
+        ? std::tuple{&b, static_cast<Limb>(y), &a, static_cast<Limb>(-x)}
+        : std::tuple{&a, static_cast<Limb>(x), &b, static_cast<Limb>(-y)};
+
+    auto size = a.size() + 1;
+
+    result.resize(size);
+    std::fill(result.begin(), result.end(), Limb{});
+
+    result[positive->size()] = multiplyLimb(result.data(), positive->data(), positive->size(), positiveFactor);
+
+    auto borrow = subtractMultiplyLimb(result.data(), negative->data(), negative->size(), negativeFactor);
+    subtractLimb(result.data() + negative->size(), result.data() + negative->size(), size - negative->size(), borrow);
+
+    trim(result);
+}
+
+// Replaces (a, b) by (b, a mod b) for trimmed magnitudes a >= b, the quotient is reported by
+// onQuotient(data, size).
+template<typename OnQuotient>
+static void gcdDivideStep(Limbs& a, Limbs& b, Limbs& next, OnQuotient&& onQuotient) {
+    ScratchLimbs quotient(a.size() - b.size() + 1);
+    next.resize(b.size());
+
+    divide(quotient.data(), next.data(), a.data(), a.size(), b.data(), b.size());
+    trim(next);
+
+    std::swap(a, b);
+    std::swap(b, next);
+    onQuotient(quotient.data(), trimmedSize(quotient.data(), quotient.size()));
+}
+
+// Greatest common divisor of trimmed magnitudes a >= b by Lehmer's algorithm. Every step is
+// reported for cofactor tracking: onMatrix(matrix) for a step on leading bits, onQuotient(data,
+// size) for a division step replacing (a, b) by (b, a - quotient * b).
+template<typename OnMatrix, typename OnQuotient>
+static Limbs gcdLehmer(Limbs a, Limbs b, OnMatrix&& onMatrix, OnQuotient&& onQuotient) {
+    Limbs nextA;
+    Limbs nextB;
+    LehmerMatrix matrix;
+
+    while (!b.empty()) {
+        auto bitLength = a.size() * limbBits - static_cast<std::size_t>(std::countl_zero(a.back()));
+        auto position = (bitLength > lehmerBits) ? (bitLength - lehmerBits) : 0;
+
+        if (lehmerMatrix(bitsAt(a.data(), a.size(), position), bitsAt(b.data(), b.size(), position), matrix)) {
+            combineLimbs(nextA, a, b, matrix.a0, matrix.b0);
+            combineLimbs(nextB, a, b, matrix.a1, matrix.b1);
+
+            std::swap(a, nextA);
+            std::swap(b, nextB);
+            onMatrix(matrix);
+        } else {
+            gcdDivideStep(a, b, nextB, onQuotient);
+        }
+    }
+    return a;
+}
+
+// Half-gcd reduction of Schonhage and Moller. The pair is not ordered, a step subtracts a multiple
+// of the smaller value from the larger one, so the cofactors are not negative and the matrix of
+// the steps has the determinant one. The reduction of a pair of n limbs stops while the difference
+// of the values still takes more than n / 2 + 1 limbs, then the matrix found for the leading limbs
+// of a longer pair is valid for the whole pair, and the leading half of a pair is reduced by the
+// recursion at the cost of a few multiplications.
+
+// Cofactors of the half-gcd reduction, (a; b) = M (alpha; beta) for the reduced pair (alpha, beta).
+struct HalfGcdMatrix {
+    Limbs entries[2][2]{{Limbs{1}, Limbs{}}, {Limbs{}, Limbs{1}}};
+};
+
+// Cofactors of a half-gcd step on the two leading limbs, laid out as the matrix.
+struct HalfGcdStepMatrix {
+    Limb entries[2][2];
+};
+
+// Compares double limb values.
+static inline bool lessDoubleLimb(Limb high, Limb low, Limb rhsHigh, Limb rhsLow) {
+    return high < rhsHigh || (high == rhsHigh && low < rhsLow);
+}
+
+// Subtracts the double limb value in place.
+static inline void subtractDoubleLimb(Limb& high, Limb& low, Limb rhsHigh, Limb rhsLow) {
+    high -= rhsHigh + static_cast<Limb>(low < rhsLow);
+    low -= rhsLow;
+}
+
+// Divides the double limb value in place leaving the remainder there, the quotient must fit into
+// a limb and the divisor high limb must not be zero.
+static inline Limb divideDoubleLimb(Limb& high, Limb& low, Limb divisorHigh, Limb divisorLow) {
+    auto shiftDivisorLeft = [&] {
+        divisorHigh = (divisorHigh << 1) | (divisorLow >> (limbBits - 1));
+        divisorLow <<= 1;
+    };
+    auto shiftDivisorRight = [&] {
+        divisorLow = (divisorHigh << (limbBits - 1)) | (divisorLow >> 1);
+        divisorHigh >>= 1;
+    };
+    auto subtractDivisor = [&](Limb& quotient) {
+        if (!lessDoubleLimb(high, low, divisorHigh, divisorLow)) {
+            subtractDoubleLimb(high, low, divisorHigh, divisorLow);
+            quotient |= 1;
+        }
+    };
+    Limb quotient{};
+    unsigned count{};
+
+    // The divisor is shifted under the numerator and taken back bit by bit.
+    if ((high >> (limbBits - 1)) != 0) {
+        for (count = 1; (divisorHigh >> (limbBits - 1)) == 0; ++count) {
+            shiftDivisorLeft();
+        }
+        for (; count > 0; --count) {
+            quotient <<= 1;
+            subtractDivisor(quotient);
+            shiftDivisorRight();
+        }
+    } else {
+        for (; !lessDoubleLimb(high, low, divisorHigh, divisorLow); ++count) {
+            shiftDivisorLeft();
+        }
+        for (; count > 0; --count) {
+            shiftDivisorRight();
+            quotient <<= 1;
+            subtractDivisor(quotient);
+        }
+    }
+    return quotient;
+}
+
+// Reduces the two leading limbs of the pair until their difference almost fits into one limb,
+// the quotients are certain for the whole pair. Returns false if no step is certain.
+static inline bool halfGcdStepMatrix(Limb ah, Limb al, Limb bh, Limb bl, HalfGcdStepMatrix& matrix) {
+    constexpr auto halfBits = limbBits / 2;
+    constexpr auto singleBound = Limb{1} << (halfBits + 1);
+
+    if (ah < 2 || bh < 2) {
+        return false;
+    }
+    auto& [u00, u01] = matrix.entries[0];
+    auto& [u10, u11] = matrix.entries[1];
+
+    if (lessDoubleLimb(bh, bl, ah, al)) {
+        subtractDoubleLimb(ah, al, bh, bl);
+
+        if (ah < 2) {
+            return false;
+        }
+        u00 = u01 = u11 = 1;
+        u10 = 0;
+    } else {
+        subtractDoubleLimb(bh, bl, ah, al);
+
+        if (bh < 2) {
+            return false;
+        }
+        u00 = u10 = u11 = 1;
+        u01 = 0;
+    }
+
+    // Subtracts q * b from a and adds q times the first column to the second one, the steps on b
+    // are symmetric. A quotient leaving the remainder below the bound is taken one less.
+    auto step = [&](Limb& x, Limb& xLow, Limb y, Limb yLow, Limb& ux0, Limb& ux1, Limb uy0, Limb uy1, bool single) {
+        auto bound = single ? singleBound : Limb{2};
+
+        if (single) {
+            x -= y;
+        } else {
+            subtractDoubleLimb(x, xLow, y, yLow);
+        }
+        if (x < bound) {
+            return false;
+        }
+        Limb quotient{1};
+
+        if (x > y) {
+            Limb remainder{};
+            quotient = single ? divideLimbs(0, x, y, remainder) : divideDoubleLimb(x, xLow, y, yLow);
+
+            if (single) {
+                x = remainder;
+            }
+            if (x < bound) {
+                ux0 += quotient * uy0;
+                ux1 += quotient * uy1;
+                return false;
+            }
+            ++quotient;
+        }
+        ux0 += quotient * uy0;
+        ux1 += quotient * uy1;
+        return true;
+    };
+    auto reduceA = !(ah < bh);
+    auto single = false;
+
+    for (;;) {
+        if (!single) {
+            // The bounds are not certain at half of the limb, the rest is done on single limbs.
+            if (ah == bh) {
+                break;
+            }
+            if ((reduceA ? ah : bh) < (Limb{1} << halfBits)) {
+                ah = (ah << halfBits) + (al >> halfBits);
+                bh = (bh << halfBits) + (bl >> halfBits);
+                single = true;
+                continue;
+            }
+        }
+        auto proceed = reduceA
+            ? step(ah, al, bh, bl, u01, u11, u00, u10, single)
+            : step(bh, bl, ah, al, u00, u10, u01, u11, single);
+
+        if (!proceed) {
+            break;
+        }
+        reduceA = !reduceA;
+    }
+    return true;
+}
+
+// Computes x * xFactor + y * yFactor of trimmed values.
+static inline void sumOfProducts(Limbs& result, const Limbs& x, Limb xFactor, const Limbs& y, Limb yFactor) {
+    auto size = std::max(x.size(), y.size()) + 1;
+
+    result.resize(size);
+    std::fill(result.begin(), result.end(), Limb{});
+
+    if (!x.empty()) {
+        result[x.size()] = multiplyLimb(result.data(), x.data(), x.size(), xFactor);
+    }
+    if (!y.empty()) {
+        auto carry = addMultiplyLimb(result.data(), y.data(), y.size(), yFactor);
+        addLimb(result.data() + y.size(), result.data() + y.size(), size - y.size(), carry);
+    }
+    trim(result);
+}
+
+// Adds the product of the values to the trimmed result.
+static inline void addProduct(Limbs& result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) {
+    lhsSize = trimmedSize(lhs, lhsSize);
+    rhsSize = trimmedSize(rhs, rhsSize);
+
+    if (lhsSize == 0 || rhsSize == 0) {
+        return;
+    }
+    ScratchLimbs product(lhsSize + rhsSize);
+    multiply(product.data(), lhs, lhsSize, rhs, rhsSize);
+
+    result.resize(std::max(result.size(), product.size()) + 1);
+    addLimbs(result.data(), result.data(), result.size(), product.data(), product.size());
+    trim(result);
+}
+
+// Multiplies the matrix by the step matrix from the right.
+static inline void multiplyMatrix(HalfGcdMatrix& matrix, const HalfGcdStepMatrix& step) {
+    Limbs first;
+    Limbs second;
+
+    for (auto& row : matrix.entries) {
+        sumOfProducts(first, row[0], step.entries[0][0], row[1], step.entries[1][0]);
+        sumOfProducts(second, row[0], step.entries[0][1], row[1], step.entries[1][1]);
+
+        std::swap(row[0], first);
+        std::swap(row[1], second);
+    }
+}
+
+// Multiplies the matrix by another one from the right.
+static inline void multiplyMatrix(HalfGcdMatrix& matrix, const HalfGcdMatrix& rhs) {
+    for (auto& row : matrix.entries) {
+        Limbs next[2];
+
+        for (std::size_t column = 0; column < 2; ++column) {
+            for (std::size_t i = 0; i < 2; ++i) {
+                const auto& entry = rhs.entries[i][column];
+                addProduct(next[column], row[i].data(), row[i].size(), entry.data(), entry.size());
+            }
+        }
+        std::swap(row[0], next[0]);
+        std::swap(row[1], next[1]);
+    }
+}
+
+// Adds the quotient times the other column to the column of the matrix.
+static inline void updateQuotient(HalfGcdMatrix& matrix, const Limb* quotient, std::size_t size, std::size_t column) {
+    for (auto& row : matrix.entries) {
+        addProduct(row[column], row[1 - column].data(), row[1 - column].size(), quotient, size);
+    }
+}
+
+// Replaces the pair of the given size by M^(-1) (a; b) for the step matrix, returns the new size.
+static inline std::size_t applyInverse(const HalfGcdStepMatrix& matrix, Limb* a, Limb* b, std::size_t size) {
+    ScratchLimbs copy(a, a + size);
+
+    // The inverse is (u11, -u01; -u10, u00), the high carries cancel.
+    multiplyLimb(a, copy.data(), size, matrix.entries[1][1]);
+    subtractMultiplyLimb(a, b, size, matrix.entries[0][1]);
+
+    multiplyLimb(b, b, size, matrix.entries[0][0]);
+    subtractMultiplyLimb(b, copy.data(), size, matrix.entries[1][0]);
+
+    while (size > 0 && (a[size - 1] | b[size - 1]) == 0) {
+        --size;
+    }
+    return size;
+}
+
+// Takes a subtraction and a division step on the pair of the given size, the steps are taken
+// while the reduced value stays above the bound of limbs. Returns the new size or zero if no step
+// is taken, the limbs above the new size are not defined.
+static std::size_t subdivideStep(Limb* a, Limb* b, std::size_t size, std::size_t bound, HalfGcdMatrix& matrix) {
+    auto aSize = trimmedSize(a, size);
+    auto bSize = trimmedSize(b, size);
+
+    // Column of the matrix taking the quotient, the first one when b is reduced.
+    std::size_t column{};
+
+    auto comparison = compareLimbs(a, aSize, b, bSize);
+
+    if (comparison == 0) {
+        return 0;
+    }
+    if (comparison > 0) {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+        column ^= 1;
+    }
+    if (aSize <= bound) {
+        return 0;
+    }
+    subtractLimbs(b, b, bSize, a, aSize);
+    bSize = trimmedSize(b, bSize);
+
+    comparison = compareLimbs(a, aSize, b, bSize);
+
+    // The subtraction is undone if the difference becomes too small.
+    if (bSize <= bound || comparison == 0) {
+        auto carry = addLimbs(b, a, aSize, b, bSize);
+
+        if (carry != 0) {
+            b[aSize] = carry;
+        }
+        return 0;
+    }
+    const Limb one{1};
+    updateQuotient(matrix, &one, 1, column);
+
+    if (comparison > 0) {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+        column ^= 1;
+    }
+    ScratchLimbs quotient(bSize - aSize + 1);
+    ScratchLimbs remainder(aSize);
+
+    divide(quotient.data(), remainder.data(), b, bSize, a, aSize);
+    std::copy(remainder.begin(), remainder.end(), b);
+    bSize = trimmedSize(b, aSize);
+
+    // The quotient is taken one less if the remainder is too small.
+    if (bSize <= bound) {
+        auto carry = addLimbs(b, a, aSize, b, bSize);
+
+        if (carry != 0) {
+            b[aSize++] = carry;
+        }
+        subtractLimb(quotient.data(), quotient.data(), quotient.size(), 1);
+    }
+    updateQuotient(matrix, quotient.data(), quotient.size(), column);
+
+    return aSize;
+}
+
+// Takes a step on the leading limbs of the pair of the given size or a division step if no step
+// on the leading limbs is certain. Returns the new size or zero if no step is taken.
+static std::size_t halfGcdStep(Limb* a, Limb* b, std::size_t size, std::size_t bound, HalfGcdMatrix& matrix) {
+    auto mask = a[size - 1] | b[size - 1];
+    Limb ah, al, bh, bl;
+
+    if (size == bound + 1) {
+        if (mask < 4) {
+            return subdivideStep(a, b, size, bound, matrix);
+        }
+        ah = a[size - 1];
+        al = a[size - 2];
+        bh = b[size - 1];
+        bl = b[size - 2];
+    } else if ((mask >> (limbBits - 1)) != 0) {
+        ah = a[size - 1];
+        al = a[size - 2];
+        bh = b[size - 1];
+        bl = b[size - 2];
+    } else {
+        auto shift = static_cast<unsigned>(std::countl_zero(mask));
+
+        ah = (a[size - 1] << shift) | (a[size - 2] >> (limbBits - shift));
+        al = (a[size - 2] << shift) | (a[size - 3] >> (limbBits - shift));
+        bh = (b[size - 1] << shift) | (b[size - 2] >> (limbBits - shift));
+        bl = (b[size - 2] << shift) | (b[size - 3] >> (limbBits - shift));
+    }
+    HalfGcdStepMatrix step{};
+
+    if (halfGcdStepMatrix(ah, al, bh, bl, step)) {
+        multiplyMatrix(matrix, step);
+        return applyInverse(step, a, b, size);
+    }
+    return subdivideStep(a, b, size, bound, matrix);
+}
+
+// Replaces the pair of the given size by M^(-1) (a; b), where the limbs from low are the leading
+// limbs of the pair already reduced by the matrix. Returns the new size.
+static std::size_t adjustHalfGcd(const HalfGcdMatrix& matrix, std::size_t size, Limb* a, Limb* b, std::size_t low) {
+    const auto& [m0, m1] = matrix.entries;
+
+    ScratchLimbs nextA(size + 1);
+    ScratchLimbs nextB(size + 1);
+
+    std::copy(a + low, a + size, nextA.data() + low);
+    std::copy(b + low, b + size, nextB.data() + low);
+
+    // Adds the product of the matrix entry and the low limbs to the result.
+    auto addLow = [&](ScratchLimbs& result, const Limbs& entry, const Limb* value, bool subtract) {
+        auto valueSize = trimmedSize(value, low);
+
+        if (entry.empty() || valueSize == 0) {
+            return;
+        }
+        ScratchLimbs product(entry.size() + valueSize);
+        multiply(product.data(), entry.data(), entry.size(), value, valueSize);
+
+        if (subtract) {
+            subtractLimbs(result.data(), result.data(), result.size(), product.data(), product.size());
+        } else {
+            addLimbs(result.data(), result.data(), result.size(), product.data(), product.size());
+        }
+    };
+    // The inverse is (m11, -m01; -m10, m00), the results are not negative.
+    addLow(nextA, m1[1], a, false);
+    addLow(nextA, m0[1], b, true);
+    addLow(nextB, m0[0], b, false);
+    addLow(nextB, m1[0], a, true);
+
+    size = std::max(trimmedSize(nextA.data(), nextA.size()), trimmedSize(nextB.data(), nextB.size()));
+
+    std::copy(nextA.data(), nextA.data() + size, a);
+    std::copy(nextB.data(), nextB.data() + size, b);
+
+    return size;
+}
+
+// Reduces the pair of the given size with not zero leading limb until the difference of the
+// values takes at most size / 2 + 1 limbs, the steps are accumulated to the matrix. Returns the
+// new size or zero if no step is taken, the limbs above the new size are not defined.
+static std::size_t halfGcd(Limb* a, Limb* b, std::size_t size, HalfGcdMatrix& matrix) {
+    auto bound = size / 2 + 1;
+    bool reduced{};
+
+    if (size <= bound) {
+        return 0;
+    }
+    if (size >= halfGcdThreshold) {
+        // The leading half is reduced to a quarter of the size by the recursion.
+        auto limit = (3 * size) / 4 + 1;
+        auto low = size / 2;
+        auto next = halfGcd(a + low, b + low, size - low, matrix);
+
+        if (next != 0) {
+            size = adjustHalfGcd(matrix, low + next, a, b, low);
+            reduced = true;
+        }
+        while (size > limit) {
+            next = halfGcdStep(a, b, size, bound, matrix);
+
+            if (next == 0) {
+                return reduced ? size : 0;
+            }
+            size = next;
+            reduced = true;
+        }
+
+        // The leading part of the rest is reduced by the second recursion.
+        if (size > bound + 2) {
+            low = 2 * bound - size + 1;
+            HalfGcdMatrix rest;
+            next = halfGcd(a + low, b + low, size - low, rest);
+
+            if (next != 0) {
+                size = adjustHalfGcd(rest, low + next, a, b, low);
+                multiplyMatrix(matrix, rest);
+                reduced = true;
+            }
+        }
+    }
+    for (;;) {
+        auto next = halfGcdStep(a, b, size, bound, matrix);
+
+        if (next == 0) {
+            return reduced ? size : 0;
+        }
+        size = next;
+        reduced = true;
+    }
+}
+
+// Greatest common divisor of trimmed magnitudes a >= b. Long pairs are reduced by the half-gcd
+// of their leading limbs reported by onHalf(matrix) for the pair replaced by M^(-1) (a; b) and
+// onSwap() for the pair reordered after that, the rest is done by Lehmer's algorithm reported as
+// in gcdLehmer().
+template<typename OnMatrix, typename OnQuotient, typename OnHalf, typename OnSwap>
+static Limbs gcdLimbs(
+    Limbs a,
+    Limbs b,
+    OnMatrix&& onMatrix,
+    OnQuotient&& onQuotient,
+    OnHalf&& onHalf,
+    OnSwap&& onSwap)
+{
+    Limbs next;
+
+    while (b.size() >= gcdThreshold) {
+        auto size = a.size();
+        auto low = 2 * size / 3;
+
+        HalfGcdMatrix matrix;
+        b.resize(size);
+
+        auto reduced = halfGcd(a.data() + low, b.data() + low, size - low, matrix);
+
+        if (reduced == 0) {
+            trim(b);
+            gcdDivideStep(a, b, next, onQuotient);
+            continue;
+        }
+        size = adjustHalfGcd(matrix, low + reduced, a.data(), b.data(), low);
+
+        a.resize(size);
+        b.resize(size);
+        trim(a);
+        trim(b);
+        onHalf(matrix);
+
+        if (compareLimbs(a.data(), a.size(), b.data(), b.size()) < 0) {
+            std::swap(a, b);
+            onSwap();
+        }
+    }
+    return gcdLehmer(std::move(a), std::move(b), onMatrix, onQuotient);
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_GCD_H
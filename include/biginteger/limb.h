@@ -0,0 +1,375 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_LIMB_H
+#define ALEF_NUMERICS_BIGINTEGER_LIMB_H
+
+#include "smallBuffer.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace wingmann::numerics::__detail {
+
+// Machine word used as a single digit of the magnitude.
+using Limb = std::uint64_t;
+
+// Magnitude stored as limbs, the least significant limb first. Values up to 128 bits are kept
+// in place without allocation.
+using Limbs = SmallBuffer<Limb, 2>;
+
+// Count of bits in a single limb.
+static constexpr unsigned limbBits = 64;
+
+// Multiplies two limbs, returns the low half and stores the high half of the product.
+static inline Limb multiplyLimbs(Limb lhs, Limb rhs, Limb& high) {
+#if defined(__SIZEOF_INT128__)
+    auto product = static_cast<unsigned __int128>(lhs) * rhs;
+    high = static_cast<Limb>(product >> limbBits);
+    return static_cast<Limb>(product);
+#else
+    const Limb mask{0xFFFF'FFFF};
+
+    Limb lhsLow = lhs & mask, lhsHigh = lhs >> 32;
+    Limb rhsLow = rhs & mask, rhsHigh = rhs >> 32;
+
+    Limb lowLow = lhsLow * rhsLow;
+    Limb lowHigh = lhsLow * rhsHigh;
+    Limb highLow = lhsHigh * rhsLow;
+    Limb highHigh = lhsHigh * rhsHigh;
+
+    Limb middle = (lowLow >> 32) + (lowHigh & mask) + (highLow & mask);
+    high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    return (middle << 32) | (lowLow & mask);
+#endif
+}
+
+// Divides the double limb (high, low) by the divisor, the high half must be less than the divisor.
+static inline Limb divideLimbs(Limb high, Limb low, Limb divisor, Limb& remainder) {
+#if defined(__SIZEOF_INT128__)
+    auto dividend = (static_cast<unsigned __int128>(high) << limbBits) | low;
+    remainder = static_cast<Limb>(dividend % divisor);
+    return static_cast<Limb>(dividend / divisor);
+#else
+    // Two steps of schoolbook division by half limbs (Hacker's Delight, divlu).
+    const Limb base{Limb{1} << 32};
+    const Limb mask{base - 1};
+
+    auto shift = static_cast<unsigned>(std::countl_zero(divisor));
+    divisor <<= shift;
+
+    Limb divisorHigh = divisor >> 32;
+    Limb divisorLow = divisor & mask;
+
+    Limb numeratorHigh = shift ? (high << shift) | (low >> (limbBits - shift)) : high;
+    Limb numeratorLow = low << shift;
+
+    auto step = [&](Limb numerator, Limb digit) {
+        Limb quotient = numerator / divisorHigh;
+        Limb rest = numerator - quotient * divisorHigh;
+
+        while (quotient >= base || quotient * divisorLow > ((rest << 32) | digit)) {
+            --quotient;
+            rest += divisorHigh;
+            if (rest >= base) {
+                break;
+            }
+        }
+        return quotient;
+    };
+    Limb quotientHigh = step(numeratorHigh, numeratorLow >> 32);
+    Limb middle = (numeratorHigh << 32) + (numeratorLow >> 32) - quotientHigh * divisor;
+
+    Limb quotientLow = step(middle, numeratorLow & mask);
+    remainder = ((middle << 32) + (numeratorLow & mask) - quotientLow * divisor) >> shift;
+
+    return (quotientHigh << 32) | quotientLow;
+#endif
+}
+
+// Computes floor((B^2 - 1) / divisor) - B for the normalized divisor, B = 2^64.
+static inline Limb reciprocalLimb(Limb divisor) {
+    Limb remainder;
+    return divideLimbs(~divisor, ~Limb{}, divisor, remainder);
+}
+
+// Divides the double limb (high, low) by the normalized divisor with its precomputed reciprocal
+// (Moller, Granlund, "Improved division by invariant integers"), the high half must be less than
+// the divisor.
+static inline Limb divideLimbs(Limb high, Limb low, Limb divisor, Limb reciprocal, Limb& remainder) {
+    Limb quotientHigh;
+    Limb quotientLow = multiplyLimbs(reciprocal, high, quotientHigh);
+
+    quotientLow += low;
+    quotientHigh += high + 1 + (quotientLow < low);
+
+    Limb rest = low - quotientHigh * divisor;
+
+    if (rest > quotientLow) {
+        --quotientHigh;
+        rest += divisor;
+    }
+    if (rest >= divisor) {
+        ++quotientHigh;
+        rest -= divisor;
+    }
+    remainder = rest;
+    return quotientHigh;
+}
+
+// Gets the count of significant limbs.
+static inline std::size_t trimmedSize(const Limb* value, std::size_t size) {
+    while (size > 0 && value[size - 1] == 0) {
+        --size;
+    }
+    return size;
+}
+
+// Removes not significant high limbs.
+static inline void trim(Limbs& value) {
+    value.resize(trimmedSize(value.data(), value.size()));
+}
+
+// Three way compares magnitudes of equal size, returns -1, 0 or 1.
+static inline int compareLimbs(const Limb* lhs, const Limb* rhs, std::size_t size) {
+    while (size-- > 0) {
+        if (lhs[size] != rhs[size]) {
+            return lhs[size] < rhs[size] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// Three way compares trimmed magnitudes, returns -1, 0 or 1.
+static inline int compareLimbs(
+    const Limb* lhs,
+    std::size_t lhsSize,
+    const Limb* rhs,
+    std::size_t rhsSize)
+{
+    if (lhsSize != rhsSize) {
+        return lhsSize < rhsSize ? -1 : 1;
+    }
+    return compareLimbs(lhs, rhs, lhsSize);
+}
+
+// Adds the limb to the value, returns carry. The result may alias the value, in this case limbs
+// above the carry are not touched.
+static inline Limb addLimb(Limb* result, const Limb* value, std::size_t size, Limb rhs) {
+    std::size_t i{};
+
+    for (; (i < size) && (rhs != 0); ++i) {
+        Limb sum = value[i] + rhs;
+        rhs = sum < rhs;
+        result[i] = sum;
+    }
+    if (result != value) {
+        std::copy(value + i, value + size, result + i);
+    }
+    return rhs;
+}
+
+// Adds values of equal size, returns carry. The result may alias any operand.
+static inline Limb addLimbs(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t size) {
+    Limb carry{};
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Limb sum = lhs[i] + carry;
+        carry = sum < carry;
+        sum += rhs[i];
+        carry += sum < rhs[i];
+        result[i] = sum;
+    }
+    return carry;
+}
+
+// Adds the shorter value to the longer one, returns carry.
+static inline Limb addLimbs(
+    Limb* result,
+    const Limb* lhs,
+    std::size_t lhsSize,
+    const Limb* rhs,
+    std::size_t rhsSize)
+{
+    Limb carry = addLimbs(result, lhs, rhs, rhsSize);
+    return addLimb(result + rhsSize, lhs + rhsSize, lhsSize - rhsSize, carry);
+}
+
+// Subtracts the limb from the value, returns borrow. The result may alias the value, in this case
+// limbs above the borrow are not touched.
+static inline Limb subtractLimb(Limb* result, const Limb* value, std::size_t size, Limb rhs) {
+    std::size_t i{};
+
+    for (; (i < size) && (rhs != 0); ++i) {
+        Limb difference = value[i] - rhs;
+        rhs = value[i] < rhs;
+        result[i] = difference;
+    }
+    if (result != value) {
+        std::copy(value + i, value + size, result + i);
+    }
+    return rhs;
+}
+
+// Subtracts values of equal size, returns borrow. The result may alias any operand.
+static inline Limb subtractLimbs(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t size) {
+    Limb borrow{};
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Limb subtrahend = rhs[i] + borrow;
+        borrow = (subtrahend < borrow) | (lhs[i] < subtrahend);
+        result[i] = lhs[i] - subtrahend;
+    }
+    return borrow;
+}
+
+// Subtracts the shorter value from the longer one, returns borrow.
+static inline Limb subtractLimbs(
+    Limb* result,
+    const Limb* lhs,
+    std::size_t lhsSize,
+    const Limb* rhs,
+    std::size_t rhsSize)
+{
+    Limb borrow = subtractLimbs(result, lhs, rhs, rhsSize);
+    return subtractLimb(result + rhsSize, lhs + rhsSize, lhsSize - rhsSize, borrow);
+}
+
+// Negates the value in two's complement of the given size.
+static inline void negateLimbs(Limb* value, std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+        value[i] = ~value[i];
+    }
+    addLimb(value, value, size, 1);
+}
+
+// Multiplies the value by the limb, returns the high limb of the product.
+static inline Limb multiplyLimb(Limb* result, const Limb* value, std::size_t size, Limb rhs) {
+    Limb carry{};
+    Limb high;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Limb low = multiplyLimbs(value[i], rhs, high) + carry;
+        carry = high + (low < carry);
+        result[i] = low;
+    }
+    return carry;
+}
+
+// Multiplies the value by the limb and adds the product to the result, returns carry limb.
+static inline Limb addMultiplyLimb(Limb* result, const Limb* value, std::size_t size, Limb rhs) {
+    Limb carry{};
+    Limb high;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Limb low = multiplyLimbs(value[i], rhs, high) + carry;
+        carry = high + (low < carry);
+        low += result[i];
+        carry += low < result[i];
+        result[i] = low;
+    }
+    return carry;
+}
+
+// Multiplies the value by the limb and subtracts the product from the result, returns borrow limb.
+static inline Limb subtractMultiplyLimb(Limb* result, const Limb* value, std::size_t size, Limb rhs) {
+    Limb borrow{};
+    Limb high;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Limb low = multiplyLimbs(value[i], rhs, high) + borrow;
+        borrow = high + (low < borrow);
+        borrow += result[i] < low;
+        result[i] -= low;
+    }
+    return borrow;
+}
+
+// Divides the value by the limb, returns remainder. The quotient may alias the value.
+static inline Limb divideLimb(Limb* quotient, const Limb* value, std::size_t size, Limb divisor) {
+    if (size == 0) {
+        return 0;
+    }
+
+    // The value is normalized together with the divisor on the fly.
+    auto shift = static_cast<unsigned>(std::countl_zero(divisor));
+    divisor <<= shift;
+
+    auto reciprocal = reciprocalLimb(divisor);
+    Limb remainder = (shift != 0) ? (value[size - 1] >> (limbBits - shift)) : Limb{};
+
+    while (size-- > 0) {
+        Limb limb = value[size] << shift;
+
+        if (shift != 0 && size > 0) {
+            limb |= value[size - 1] >> (limbBits - shift);
+        }
+        quotient[size] = divideLimbs(remainder, limb, divisor, reciprocal, remainder);
+    }
+    return remainder >> shift;
+}
+
+// Divides the value by the limb known to divide it exactly (Hensel division).
+// The quotient may alias the value.
+static inline void divideExactLimb(Limb* quotient, const Limb* value, std::size_t size, Limb divisor) {
+    auto shift = static_cast<unsigned>(std::countr_zero(divisor));
+    divisor >>= shift;
+
+    // Inverse of the odd divisor modulo 2^64, each Newton step doubles the count of correct bits.
+    Limb inverse{divisor};
+
+    for (int i = 0; i < 5; ++i) {
+        inverse *= 2 - divisor * inverse;
+    }
+    Limb borrow{};
+    Limb high;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Limb limb = value[i];
+
+        if (shift != 0) {
+            limb = (limb >> shift) | ((i + 1 < size) ? (value[i + 1] << (limbBits - shift)) : Limb{});
+        }
+        Limb difference = limb - borrow;
+        Limb digit = difference * inverse;
+
+        multiplyLimbs(digit, divisor, high);
+        borrow = high + (limb < borrow);
+        quotient[i] = digit;
+    }
+}
+
+// Shifts the value to left on 0 < shift < limbBits, returns shifted out bits.
+// The result may alias the value or be placed higher than it.
+static inline Limb shiftLeftLimbs(Limb* result, const Limb* value, std::size_t size, unsigned shift) {
+    Limb out{};
+
+    if (size > 0) {
+        out = value[size - 1] >> (limbBits - shift);
+
+        for (std::size_t i = size - 1; i > 0; --i) {
+            result[i] = (value[i] << shift) | (value[i - 1] >> (limbBits - shift));
+        }
+        result[0] = value[0] << shift;
+    }
+    return out;
+}
+
+// Shifts the value to right on 0 < shift < limbBits, returns shifted out bits at high positions.
+// The result may alias the value or be placed lower than it.
+static inline Limb shiftRightLimbs(Limb* result, const Limb* value, std::size_t size, unsigned shift) {
+    Limb out{};
+
+    if (size > 0) {
+        out = value[0] << (limbBits - shift);
+
+        for (std::size_t i = 0; i < size - 1; ++i) {
+            result[i] = (value[i] >> shift) | (value[i + 1] << (limbBits - shift));
+        }
+        result[size - 1] = value[size - 1] >> shift;
+    }
+    return out;
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_LIMB_H
@@ -0,0 +1,282 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_MODULAR_H
+#define ALEF_NUMERICS_BIGINTEGER_MODULAR_H
+
+#include "division.h"
+#include "limb.h"
+#include "multiplication.h"
+#include "scratch.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace wingmann::numerics::__detail {
+
+// Gets the bit of the value at the position.
+static inline bool testBit(const Limb* value, std::size_t position) {
+    return ((value[position / limbBits] >> (position % limbBits)) & 1) != 0;
+}
+
+// Gets the window size in bits of the exponentiation by the exponent bit length.
+static constexpr unsigned powerWindowBits(std::size_t exponentBits) {
+    if (exponentBits > 671) {
+        return 6;
+    }
+    if (exponentBits > 239) {
+        return 5;
+    }
+    if (exponentBits > 79) {
+        return 4;
+    }
+    if (exponentBits > 23) {
+        return 3;
+    }
+    return 1;
+}
+
+// Scans the trimmed exponent from the leading bit by left to right sliding windows of at most the
+// given count of bits starting and ending with one bits. The visitor gets the odd digit of each
+// window and the count of squarings due before it, that is the bits since the previous window;
+// the leading window has none. Trailing zero bits come last with the zero digit.
+template<typename Visitor>
+static void scanWindows(const Limb* exponent, std::size_t exponentSize, unsigned window, Visitor&& visit) {
+    auto bits = exponentSize * limbBits - static_cast<std::size_t>(std::countl_zero(exponent[exponentSize - 1]));
+    std::size_t squarings{};
+    bool first{true};
+
+    for (auto position = bits; position-- > 0;) {
+        if (!testBit(exponent, position)) {
+            ++squarings;
+            continue;
+        }
+        auto low = (position + 1 >= window) ? (position + 1 - window) : 0;
+
+        while (!testBit(exponent, low)) {
+            ++low;
+        }
+        std::size_t digit{};
+
+        for (auto i = position + 1; i-- > low;) {
+            digit = (digit << 1) | (testBit(exponent, i) ? 1 : 0);
+        }
+        visit(digit, first ? 0 : squarings + (position + 1 - low));
+
+        squarings = 0;
+        first = false;
+        position = low;
+    }
+    if (squarings != 0) {
+        visit(std::size_t{}, squarings);
+    }
+}
+
+// Raises the base of the given size to the not zero power of the trimmed exponent by left to
+// right sliding windows over the exponent bits, the odd powers of the base are precomputed.
+// The step multiplies values of the size, step(result, lhs, rhs) may write the result over lhs.
+// Squarings pass the same operand twice, so the multiplication inside the step squares it.
+template<typename Step>
+static void powerWindow(
+    Limb* result,
+    const Limb* base,
+    std::size_t size,
+    const Limb* exponent,
+    std::size_t exponentSize,
+    Step&& step)
+{
+    auto bits = exponentSize * limbBits - static_cast<std::size_t>(std::countl_zero(exponent[exponentSize - 1]));
+    auto window = powerWindowBits(bits);
+
+    // Odd powers base^1, base^3, ..., base^(2^window - 1).
+    ScratchLimbs table(size << (window - 1));
+    std::copy(base, base + size, table.data());
+
+    if (window > 1) {
+        ScratchLimbs square(size);
+        step(square.data(), base, base);
+
+        for (std::size_t i = 1; i < (std::size_t{1} << (window - 1)); ++i) {
+            step(table.data() + i * size, table.data() + (i - 1) * size, square.data());
+        }
+    }
+    bool first{true};
+
+    scanWindows(exponent, exponentSize, window, [&](std::size_t digit, std::size_t squarings) {
+        for (std::size_t i = 0; i < squarings; ++i) {
+            step(result, result, result);
+        }
+        if (digit == 0) {
+            return;
+        }
+        const auto entry = table.data() + (digit / 2) * size;
+
+        if (first) {
+            std::copy(entry, entry + size, result);
+            first = false;
+        } else {
+            step(result, result, entry);
+        }
+    });
+}
+
+// Gets -modulus^(-1) modulo the limb base for the odd low limb of the modulus.
+static constexpr Limb montgomeryInverse(Limb modulus) {
+    // Newton's iteration doubles the count of correct bits starting from three.
+    Limb inverse{modulus};
+
+    for (int i = 0; i < 5; ++i) {
+        inverse *= 2 - modulus * inverse;
+    }
+    return Limb{} - inverse;
+}
+
+// Montgomery reduction (REDC) of the value below modulus * B^size, the value takes 2 * size limbs
+// and is destroyed. The result takes size limbs and is below the modulus.
+static inline void montgomeryReduce(
+    Limb* result,
+    Limb* value,
+    const Limb* modulus,
+    std::size_t size,
+    Limb inverse)
+{
+    // Each step zeroes the low limb, its carry is kept there and added to the high half at once.
+    for (std::size_t i = 0; i < size; ++i) {
+        value[i] = addMultiplyLimb(value + i, modulus, size, value[i] * inverse);
+    }
+    auto carry = addLimbs(result, value + size, value, size);
+
+    if (carry != 0 || compareLimbs(result, modulus, size) >= 0) {
+        subtractLimbs(result, result, modulus, size);
+    }
+}
+
+// Montgomery multiplication of values below the odd modulus, the result may alias the operands.
+// The product takes 2 * size limbs.
+static inline void montgomeryMultiply(
+    Limb* result,
+    const Limb* lhs,
+    const Limb* rhs,
+    const Limb* modulus,
+    std::size_t size,
+    Limb inverse,
+    Limb* product)
+{
+    multiply(product, lhs, size, rhs, size);
+    montgomeryReduce(result, product, modulus, size, inverse);
+}
+
+// Gets the Barrett reciprocal B^(2 * size) / modulus of the trimmed modulus.
+static inline Limbs barrettReciprocal(const Limb* modulus, std::size_t size) {
+    ScratchLimbs numerator(2 * size + 1);
+    numerator[2 * size] = 1;
+
+    Limbs reciprocal(size + 2);
+    ScratchLimbs remainder(size);
+
+    divide(reciprocal.data(), remainder.data(), numerator.data(), numerator.size(), modulus, size);
+    trim(reciprocal);
+
+    return reciprocal;
+}
+
+// Barrett reduction of the value below modulus^2 by the trimmed modulus, the result takes size
+// limbs and may alias the value.
+static inline void barrettReduce(
+    Limb* result,
+    const Limb* value,
+    std::size_t valueSize,
+    const Limb* modulus,
+    std::size_t size,
+    const Limbs& reciprocal)
+{
+    ScratchLimbs rest(size + 1);
+    std::copy(value, value + std::min(valueSize, size + 1), rest.data());
+
+    // The estimate (value / B^(size - 1)) * reciprocal / B^(size + 1) is at most two too small.
+    if (valueSize >= size) {
+        auto high = value + (size - 1);
+        auto highSize = valueSize - (size - 1);
+
+        ScratchLimbs estimate(highSize + reciprocal.size());
+        multiply(estimate.data(), high, highSize, reciprocal.data(), reciprocal.size());
+
+        if (estimate.size() > size + 1) {
+            auto quotient = estimate.data() + (size + 1);
+            auto quotientSize = estimate.size() - (size + 1);
+
+            ScratchLimbs product(quotientSize + size);
+            multiply(product.data(), quotient, quotientSize, modulus, size);
+
+            subtractLimbs(rest.data(), rest.data(), product.data(), std::min(product.size(), size + 1));
+        }
+    }
+    while (compareLimbs(rest.data(), trimmedSize(rest.data(), size + 1), modulus, size) >= 0) {
+        subtractLimbs(rest.data(), rest.data(), size + 1, modulus, size);
+    }
+    std::copy(rest.data(), rest.data() + size, result);
+}
+
+// Reduces the value shifted by the given count of limbs modulo the trimmed modulus, the result
+// takes size limbs of the modulus.
+static inline void reduceShifted(
+    Limb* result,
+    const Limb* value,
+    std::size_t valueSize,
+    std::size_t shift,
+    const Limb* modulus,
+    std::size_t size)
+{
+    ScratchLimbs numerator(std::max(valueSize + shift, size));
+    std::copy(value, value + valueSize, numerator.data() + shift);
+
+    auto numeratorSize = trimmedSize(numerator.data(), numerator.size());
+
+    if (numeratorSize < size) {
+        std::copy(numerator.begin(), numerator.begin() + size, result);
+        return;
+    }
+    ScratchLimbs quotient(numeratorSize - size + 1);
+    divide(quotient.data(), result, numerator.data(), numeratorSize, modulus, size);
+}
+
+// Raises the base below the trimmed modulus to the not zero power of the trimmed exponent modulo
+// the modulus. Odd moduli work in the Montgomery form, others use Barrett reduction.
+// The base and the result take size limbs of the modulus.
+static void powerModulo(
+    Limb* result,
+    const Limb* base,
+    const Limb* exponent,
+    std::size_t exponentSize,
+    const Limb* modulus,
+    std::size_t size)
+{
+    ScratchLimbs product(2 * size);
+
+    if ((modulus[0] & 1) == 0) {
+        const auto reciprocal = barrettReciprocal(modulus, size);
+
+        auto step = [&](Limb* stepResult, const Limb* lhs, const Limb* rhs) {
+            multiply(product.data(), lhs, size, rhs, size);
+            barrettReduce(stepResult, product.data(), product.size(), modulus, size, reciprocal);
+        };
+        powerWindow(result, base, size, exponent, exponentSize, step);
+        return;
+    }
+    const auto inverse = montgomeryInverse(modulus[0]);
+
+    ScratchLimbs form(size);
+    reduceShifted(form.data(), base, size, size, modulus, size);
+
+    auto step = [&](Limb* stepResult, const Limb* lhs, const Limb* rhs) {
+        montgomeryMultiply(stepResult, lhs, rhs, modulus, size, inverse, product.data());
+    };
+    powerWindow(result, form.data(), size, exponent, exponentSize, step);
+
+    // Leaves the Montgomery form.
+    std::copy(result, result + size, product.data());
+    std::fill(product.data() + size, product.end(), Limb{});
+
+    montgomeryReduce(result, product.data(), modulus, size, inverse);
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_MODULAR_H
@@ -0,0 +1,302 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_MODULUS_H
+#define ALEF_NUMERICS_BIGINTEGER_MODULUS_H
+
+#include "bigInteger.h"
+#include "modular.h"
+#include "scratch.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace wingmann::numerics {
+
+/**
+ * @brief Modulus with precomputed reduction constants for repeated modular arithmetic.
+ *
+ * Values are converted once by toForm() and stay in the modular form between operations: odd
+ * moduli keep values in Montgomery form, other moduli keep plain residues reduced by Barrett
+ * reduction. Operations accept values in the form only, that is in the range [0, modulus).
+ */
+class Modulus {
+    // Absolute value of the modulus.
+    BigInteger modulus_;
+
+    // Barrett reciprocal B^(2 * size) / modulus of even moduli.
+    __detail::Limbs reciprocal_;
+
+    // -modulus^(-1) mod B of odd moduli.
+    __detail::Limb inverse_{};
+
+    // B^(2 * size) mod modulus of odd moduli.
+    BigInteger square_;
+
+    // One in the form.
+    BigInteger one_;
+
+public:
+    /**
+     * @brief Precomputes the constants of the modulus.
+     * @param modulus Not zero modulus, its sign is ignored.
+     */
+    explicit Modulus(const BigInteger& modulus) : modulus_{modulus.abs()} {
+        if (modulus_.value_.empty()) {
+            throw std::invalid_argument("divide by zero");
+        }
+        const auto& divisor = modulus_.value_;
+
+        if (isMontgomery()) {
+            const __detail::Limb unit{1};
+            __detail::Limbs square(divisor.size());
+
+            inverse_ = __detail::montgomeryInverse(divisor[0]);
+            __detail::reduceShifted(square.data(), &unit, 1, 2 * divisor.size(), divisor.data(), divisor.size());
+            square_ = BigInteger::fromLimbs(std::move(square), false);
+        } else {
+            reciprocal_ = __detail::barrettReciprocal(divisor.data(), divisor.size());
+        }
+        one_ = toForm(1);
+    }
+
+    /**
+     * @brief Gets the modulus.
+     * @return Absolute value of the modulus.
+     */
+    [[nodiscard]]
+    const BigInteger& value() const {
+        return modulus_;
+    }
+
+    /**
+     * @brief Gets one in the form.
+     * @return One in the form.
+     */
+    [[nodiscard]]
+    const BigInteger& one() const {
+        return one_;
+    }
+
+    /**
+     * @brief Converts the value to the form, any value is accepted.
+     *
+     * @param value The value to convert.
+     * @return Value in the form.
+     */
+    [[nodiscard]]
+    BigInteger toForm(const BigInteger& value) const {
+        BigInteger residue{value, value.get_allocator()};
+        residue.modAssign(modulus_);
+
+        if (residue.isNegative()) {
+            residue.addAssign(modulus_);
+        }
+        if (isMontgomery()) {
+            return multiply(residue, square_);
+        }
+        return residue;
+    }
+
+    /**
+     * @brief Converts the value in the form back to the residue.
+     *
+     * @param value Value in the form.
+     * @return Residue in the range [0, modulus).
+     */
+    [[nodiscard]]
+    BigInteger fromForm(const BigInteger& value) const {
+        check(value);
+
+        if (!isMontgomery()) {
+            return BigInteger{value, value.get_allocator()};
+        }
+        __detail::ScratchLimbs product(2 * size());
+        std::copy(value.value_.begin(), value.value_.end(), product.data());
+
+        return reduce(product);
+    }
+
+    /**
+     * @brief Adds values in the form.
+     *
+     * @param lhs The left operand.
+     * @param rhs The right operand.
+     * @return Sum in the form.
+     */
+    [[nodiscard]]
+    BigInteger add(const BigInteger& lhs, const BigInteger& rhs) const {
+        check(lhs);
+        check(rhs);
+
+        BigInteger result{lhs, lhs.get_allocator()};
+        result.addAssign(rhs);
+
+        if (result >= modulus_) {
+            result.subtractAssign(modulus_);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Subtracts values in the form.
+     *
+     * @param lhs The left operand.
+     * @param rhs The right operand.
+     * @return Difference in the form.
+     */
+    [[nodiscard]]
+    BigInteger subtract(const BigInteger& lhs, const BigInteger& rhs) const {
+        check(lhs);
+        check(rhs);
+
+        BigInteger result{lhs, lhs.get_allocator()};
+        result.subtractAssign(rhs);
+
+        if (result.isNegative()) {
+            result.addAssign(modulus_);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Negates the value in the form.
+     *
+     * @param value The value to negate.
+     * @return Negated value in the form.
+     */
+    [[nodiscard]]
+    BigInteger negate(const BigInteger& value) const {
+        return subtract(BigInteger{}, value);
+    }
+
+    /**
+     * @brief Multiplies values in the form.
+     *
+     * @param lhs The left operand.
+     * @param rhs The right operand.
+     * @return Product in the form.
+     */
+    [[nodiscard]]
+    BigInteger multiply(const BigInteger& lhs, const BigInteger& rhs) const {
+        check(lhs);
+        check(rhs);
+
+        if (lhs.value_.empty() || rhs.value_.empty()) {
+            return BigInteger{};
+        }
+        __detail::ScratchLimbs product(2 * size());
+        __detail::multiply(
+            product.data(),
+            lhs.value_.data(),
+            lhs.value_.size(),
+            rhs.value_.data(),
+            rhs.value_.size());
+
+        return reduce(product);
+    }
+
+    /**
+     * @brief Squares the value in the form.
+     *
+     * @param value The value to square.
+     * @return Square in the form.
+     */
+    [[nodiscard]]
+    BigInteger square(const BigInteger& value) const {
+        check(value);
+
+        if (value.value_.empty()) {
+            return BigInteger{};
+        }
+        __detail::ScratchLimbs product(2 * size());
+        __detail::square(product.data(), value.value_.data(), value.value_.size());
+
+        return reduce(product);
+    }
+
+    /**
+     * @brief Raises the value in the form to the power, a negative exponent raises the inverse.
+     *
+     * @param value    The base in the form.
+     * @param exponent The exponent.
+     * @return Power in the form.
+     */
+    [[nodiscard]]
+    BigInteger power(const BigInteger& value, const BigInteger& exponent) const {
+        if (exponent.isNegative()) {
+            return power(inverse(value), exponent.negate());
+        }
+        check(value);
+
+        if (exponent.value_.empty()) {
+            return one_;
+        }
+        if (value.value_.empty()) {
+            return BigInteger{};
+        }
+        const auto& divisor = modulus_.value_;
+
+        __detail::ScratchLimbs base(size());
+        __detail::ScratchLimbs product(2 * size());
+        __detail::Limbs result(size());
+
+        std::copy(value.value_.begin(), value.value_.end(), base.data());
+
+        auto step = [&](__detail::Limb* stepResult, const __detail::Limb* lhs, const __detail::Limb* rhs) {
+            __detail::multiply(product.data(), lhs, size(), rhs, size());
+
+            if (isMontgomery()) {
+                __detail::montgomeryReduce(stepResult, product.data(), divisor.data(), size(), inverse_);
+            } else {
+                __detail::barrettReduce(stepResult, product.data(), product.size(), divisor.data(), size(), reciprocal_);
+            }
+        };
+        __detail::powerWindow(result.data(), base.data(), size(), exponent.value_.data(), exponent.value_.size(), step);
+
+        return BigInteger::fromLimbs(std::move(result), false);
+    }
+
+    /**
+     * @brief Inverts the value in the form.
+     *
+     * @param value The value to invert.
+     * @return Inverse in the form.
+     */
+    [[nodiscard]]
+    BigInteger inverse(const BigInteger& value) const {
+        return toForm(fromForm(value).modInverse(modulus_));
+    }
+
+private:
+    [[nodiscard]]
+    bool isMontgomery() const {
+        return (modulus_.value_[0] & 1) != 0;
+    }
+
+    [[nodiscard]]
+    std::size_t size() const {
+        return modulus_.value_.size();
+    }
+
+    // Checks that the value is in the range of the form.
+    void check(const BigInteger& value) const {
+        if (value.isNegative() || value >= modulus_) {
+            throw std::invalid_argument("value is out of the modulus range");
+        }
+    }
+
+    // Reduces the product of values in the form taking 2 * size limbs.
+    BigInteger reduce(__detail::ScratchLimbs& product) const {
+        const auto& divisor = modulus_.value_;
+        __detail::Limbs result(size());
+
+        if (isMontgomery()) {
+            __detail::montgomeryReduce(result.data(), product.data(), divisor.data(), size(), inverse_);
+        } else {
+            __detail::barrettReduce(result.data(), product.data(), product.size(), divisor.data(), size(), reciprocal_);
+        }
+        return BigInteger::fromLimbs(std::move(result), false);
+    }
+};
+
+} // namespace wingmann::numerics
+
+#endif // ALEF_NUMERICS_BIGINTEGER_MODULUS_H
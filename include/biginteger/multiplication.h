@@ -0,0 +1,550 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_MULTIPLICATION_H
+#define ALEF_NUMERICS_BIGINTEGER_MULTIPLICATION_H
+
+#include "limb.h"
+#include "ntt.h"
+#include "scratch.h"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+// Operand size in limbs from which Karatsuba multiplication is used.
+#ifndef WINGMANN_BIGINTEGER_KARATSUBA_THRESHOLD
+#define WINGMANN_BIGINTEGER_KARATSUBA_THRESHOLD 32
+#endif
+
+// Operand size in limbs from which Toom-3 multiplication is used.
+#ifndef WINGMANN_BIGINTEGER_TOOM3_THRESHOLD
+#define WINGMANN_BIGINTEGER_TOOM3_THRESHOLD 100
+#endif
+
+// Operand size in limbs from which Toom-4 multiplication is used.
+#ifndef WINGMANN_BIGINTEGER_TOOM4_THRESHOLD
+#define WINGMANN_BIGINTEGER_TOOM4_THRESHOLD 300
+#endif
+
+// Operand size in limbs from which Karatsuba squaring is used.
+#ifndef WINGMANN_BIGINTEGER_SQUARE_THRESHOLD
+#define WINGMANN_BIGINTEGER_SQUARE_THRESHOLD 48
+#endif
+
+// Shorter operand size in limbs from which number theoretic transform multiplication is used.
+#ifndef WINGMANN_BIGINTEGER_NTT_THRESHOLD
+#define WINGMANN_BIGINTEGER_NTT_THRESHOLD 2500
+#endif
+
+namespace wingmann::numerics::__detail {
+
+static constexpr std::size_t karatsubaThreshold = WINGMANN_BIGINTEGER_KARATSUBA_THRESHOLD;
+static constexpr std::size_t toom3Threshold = WINGMANN_BIGINTEGER_TOOM3_THRESHOLD;
+static constexpr std::size_t toom4Threshold = WINGMANN_BIGINTEGER_TOOM4_THRESHOLD;
+static constexpr std::size_t squareThreshold = WINGMANN_BIGINTEGER_SQUARE_THRESHOLD;
+static constexpr std::size_t nttThreshold = WINGMANN_BIGINTEGER_NTT_THRESHOLD;
+
+static_assert(karatsubaThreshold >= 8, "Karatsuba threshold is too small");
+static_assert(toom3Threshold >= karatsubaThreshold, "thresholds must not decrease");
+static_assert(toom4Threshold >= toom3Threshold, "thresholds must not decrease");
+static_assert(toom4Threshold >= 16, "Toom-4 threshold is too small");
+static_assert(squareThreshold >= karatsubaThreshold, "squaring threshold is too small");
+static_assert(squareThreshold <= toom3Threshold, "squaring threshold is too large");
+
+static void multiply(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize);
+
+static void multiplyBalanced(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t size, Limb* scratch);
+
+// Schoolbook multiplication, the right operand must not be empty and the result must not overlap
+// the operands.
+static inline void multiplyBasecase(
+    Limb* result,
+    const Limb* lhs,
+    std::size_t lhsSize,
+    const Limb* rhs,
+    std::size_t rhsSize)
+{
+    result[lhsSize] = multiplyLimb(result, lhs, lhsSize, rhs[0]);
+
+    for (std::size_t i = 1; i < rhsSize; ++i) {
+        result[lhsSize + i] = addMultiplyLimb(result + i, lhs, lhsSize, rhs[i]);
+    }
+}
+
+// Schoolbook squaring, every cross product is computed once and doubled. The value must not be
+// empty and the result must not overlap it.
+static inline void squareBasecase(Limb* result, const Limb* value, std::size_t size) {
+    // Cross products value[i] * value[j] with i < j.
+    result[0] = 0;
+    result[size] = multiplyLimb(result + 1, value + 1, size - 1, value[0]);
+
+    for (std::size_t i = 1; i + 1 < size; ++i) {
+        result[size + i] = addMultiplyLimb(result + 2 * i + 1, value + i + 1, size - i - 1, value[i]);
+    }
+    result[2 * size - 1] = 0;
+
+    if (size > 1) {
+        shiftLeftLimbs(result, result, 2 * size, 1);
+    }
+
+    // Squares of the limbs on the diagonal.
+    Limb carry{};
+
+    for (std::size_t i = 0; i < size; ++i) {
+        Limb high;
+        Limb low = multiplyLimbs(value[i], value[i], high);
+
+        Limb sum = result[2 * i] + carry;
+        carry = sum < carry;
+        sum += low;
+        carry += sum < low;
+        result[2 * i] = sum;
+
+        sum = result[2 * i + 1] + carry;
+        carry = sum < carry;
+        sum += high;
+        carry += sum < high;
+        result[2 * i + 1] = sum;
+    }
+}
+
+// Gets the scratch size in limbs used by the balanced multiplication.
+static inline std::size_t multiplyScratchSize(std::size_t size) {
+    if (size < karatsubaThreshold || size >= toom3Threshold) {
+        return 0;
+    }
+    auto low = (size + 1) / 2;
+    return 4 * low + 1 + multiplyScratchSize(low);
+}
+
+// Stores |lhs - rhs| in lhsSize limbs, lhsSize must not be less than rhsSize.
+// Returns true if the difference is negative.
+static inline bool subtractAbsolute(
+    Limb* result,
+    const Limb* lhs,
+    std::size_t lhsSize,
+    const Limb* rhs,
+    std::size_t rhsSize)
+{
+    auto lhsTrimmed = trimmedSize(lhs, lhsSize);
+    auto rhsTrimmed = trimmedSize(rhs, rhsSize);
+
+    if (compareLimbs(lhs, lhsTrimmed, rhs, rhsTrimmed) >= 0) {
+        subtractLimbs(result, lhs, lhsSize, rhs, rhsSize);
+        return false;
+    }
+    subtractLimbs(result, rhs, rhsTrimmed, lhs, lhsTrimmed);
+    std::fill(result + rhsTrimmed, result + lhsSize, Limb{});
+
+    return true;
+}
+
+// Karatsuba multiplication of equal size operands.
+//
+// With a = a1 * B^low + a0 and b = b1 * B^low + b0 the middle coefficient is computed
+// as a0 * b0 + a1 * b1 - (a0 - a1) * (b0 - b1), which keeps all parts at most low limbs long.
+// Equal operands are squared, the three products become squares of the parts.
+static inline void multiplyKaratsuba(
+    Limb* result,
+    const Limb* lhs,
+    const Limb* rhs,
+    std::size_t size,
+    Limb* scratch)
+{
+    auto low = (size + 1) / 2;
+    auto high = size - low;
+
+    auto lhsDifference = scratch;
+    auto rhsDifference = scratch + low;
+    auto product = scratch + 2 * low + 1;
+
+    multiplyBalanced(result, lhs, rhs, low, scratch);
+    multiplyBalanced(result + 2 * low, lhs + low, rhs + low, high, scratch);
+
+    auto negative = subtractAbsolute(lhsDifference, lhs, low, lhs + low, high);
+
+    if (lhs == rhs) {
+        rhsDifference = lhsDifference;
+        negative = false;
+    } else {
+        negative = negative != subtractAbsolute(rhsDifference, rhs, low, rhs + low, high);
+    }
+    multiplyBalanced(product, lhsDifference, rhsDifference, low, product + 2 * low);
+
+    auto middle = scratch;
+    middle[2 * low] = addLimbs(middle, result, 2 * low, result + 2 * low, 2 * high);
+
+    if (negative) {
+        middle[2 * low] += addLimbs(middle, middle, product, 2 * low);
+    } else {
+        middle[2 * low] -= subtractLimbs(middle, middle, product, 2 * low);
+    }
+    addLimbs(result + low, result + low, low + 2 * high, middle, 2 * low + 1);
+}
+
+// Multiplies the evaluated values into two's complement number of width limbs.
+static inline void multiplyEvaluated(
+    Limb* result,
+    std::size_t width,
+    const Limb* lhs,
+    const Limb* rhs,
+    std::size_t size,
+    bool negative)
+{
+    multiply(result, lhs, size, rhs, size);
+    std::fill(result + 2 * size, result + width, Limb{});
+
+    if (negative) {
+        negateLimbs(result, width);
+    }
+}
+
+// Subtracts the value multiplied by the limb from two's complement number of width limbs.
+static inline void subtractMultiple(Limb* result, std::size_t width, const Limb* value, std::size_t size, Limb factor) {
+    auto borrow = subtractMultiplyLimb(result, value, size, factor);
+    subtractLimb(result + size, result + size, width - size, borrow);
+}
+
+// Adds the coefficient to the product at the offset.
+static inline void addCoefficient(
+    Limb* result,
+    std::size_t size,
+    std::size_t offset,
+    const Limb* coefficient,
+    std::size_t width)
+{
+    addLimbs(result + offset, result + offset, size - offset, coefficient, trimmedSize(coefficient, width));
+}
+
+// Evaluates a0 + a1 * x + a2 * x^2 at the points 1, -1 and 2, each value takes part + 1 limbs.
+// Returns true if the value at -1 is negative.
+static inline bool evaluateToom3(
+    Limb* one,
+    Limb* minusOne,
+    Limb* two,
+    const Limb* value,
+    std::size_t part,
+    std::size_t top)
+{
+    auto a0 = value;
+    auto a1 = value + part;
+    auto a2 = value + 2 * part;
+
+    one[part] = addLimbs(one, a0, part, a2, top);
+    auto negative = subtractAbsolute(minusOne, one, part + 1, a1, part);
+    one[part] += addLimbs(one, one, a1, part);
+
+    std::fill(two + top, two + part + 1, Limb{});
+    two[top] = shiftLeftLimbs(two, a2, top, 1);
+    addLimbs(two, two, part + 1, a1, part);
+    shiftLeftLimbs(two, two, part + 1, 1);
+    addLimbs(two, two, part + 1, a0, part);
+
+    return negative;
+}
+
+// Toom-3 multiplication of equal size operands.
+//
+// Operands are split into three parts and evaluated at the points 0, 1, -1, 2 and infinity.
+// Values at -1 are kept in two's complement, so that every interpolation step is a plain
+// addition, subtraction, shift or exact division modulo B^width. Equal operands are evaluated
+// once and the products become squares.
+static void multiplyToom3(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t size) {
+    auto part = (size + 2) / 3;
+    auto top = size - 2 * part;
+    auto width = 2 * part + 2;
+
+    ScratchLimbs workspace(6 * (part + 1) + 3 * width);
+
+    auto lhsOne = workspace.data();
+    auto lhsMinusOne = lhsOne + (part + 1);
+    auto lhsTwo = lhsMinusOne + (part + 1);
+    auto rhsOne = lhsTwo + (part + 1);
+    auto rhsMinusOne = rhsOne + (part + 1);
+    auto rhsTwo = rhsMinusOne + (part + 1);
+
+    auto one = rhsTwo + (part + 1);
+    auto minusOne = one + width;
+    auto two = minusOne + width;
+
+    auto negative = evaluateToom3(lhsOne, lhsMinusOne, lhsTwo, lhs, part, top);
+
+    if (lhs == rhs) {
+        rhsOne = lhsOne;
+        rhsMinusOne = lhsMinusOne;
+        rhsTwo = lhsTwo;
+        negative = false;
+    } else {
+        negative = negative != evaluateToom3(rhsOne, rhsMinusOne, rhsTwo, rhs, part, top);
+    }
+
+    auto zero = result;
+    auto infinity = result + 4 * part;
+
+    multiply(zero, lhs, part, rhs, part);
+    multiply(infinity, lhs + 2 * part, top, rhs + 2 * part, top);
+    std::fill(result + 2 * part, result + 4 * part, Limb{});
+
+    multiplyEvaluated(one, width, lhsOne, rhsOne, part + 1, false);
+    multiplyEvaluated(minusOne, width, lhsMinusOne, rhsMinusOne, part + 1, negative);
+    multiplyEvaluated(two, width, lhsTwo, rhsTwo, part + 1, false);
+
+    // c1 + c3
+    subtractLimbs(one, one, minusOne, width);
+    shiftRightLimbs(one, one, width, 1);
+
+    // c2
+    addLimbs(minusOne, minusOne, one, width);
+    subtractLimbs(minusOne, minusOne, width, zero, 2 * part);
+    subtractLimbs(minusOne, minusOne, width, infinity, 2 * top);
+
+    // c3
+    subtractLimbs(two, two, width, zero, 2 * part);
+    subtractMultiple(two, width, infinity, 2 * top, 16);
+    subtractMultiple(two, width, minusOne, width, 4);
+    shiftRightLimbs(two, two, width, 1);
+    subtractLimbs(two, two, one, width);
+    divideExactLimb(two, two, width, 3);
+
+    // c1
+    subtractLimbs(one, one, two, width);
+
+    addCoefficient(result, 2 * size, part, one, width);
+    addCoefficient(result, 2 * size, 2 * part, minusOne, width);
+    addCoefficient(result, 2 * size, 3 * part, two, width);
+}
+
+// Evaluates a0 + a1 * x + a2 * x^2 + a3 * x^3 at the points 1, -1, 2, -2 and 1/2 (scaled by 8),
+// each value takes part + 1 limbs. Returns signs of the values at -1 and -2.
+static inline std::pair<bool, bool> evaluateToom4(
+    Limb* one,
+    Limb* minusOne,
+    Limb* two,
+    Limb* minusTwo,
+    Limb* half,
+    const Limb* value,
+    std::size_t part,
+    std::size_t top)
+{
+    auto a0 = value;
+    auto a1 = value + part;
+    auto a2 = value + 2 * part;
+    auto a3 = value + 3 * part;
+
+    // a0 + a2 and a1 + a3
+    one[part] = addLimbs(one, a0, a2, part);
+    half[part] = addLimbs(half, a1, part, a3, top);
+
+    auto negativeOne = subtractAbsolute(minusOne, one, part + 1, half, part + 1);
+    addLimbs(one, one, half, part + 1);
+
+    // a0 + 4 * a2 and 2 * a1 + 8 * a3
+    two[part] = shiftLeftLimbs(two, a2, part, 2);
+    addLimbs(two, two, part + 1, a0, part);
+
+    std::fill(half + top, half + part + 1, Limb{});
+    half[top] = shiftLeftLimbs(half, a3, top, 2);
+    addLimbs(half, half, part + 1, a1, part);
+    shiftLeftLimbs(half, half, part + 1, 1);
+
+    auto negativeTwo = subtractAbsolute(minusTwo, two, part + 1, half, part + 1);
+    addLimbs(two, two, half, part + 1);
+
+    // 8 * a0 + 4 * a1 + 2 * a2 + a3
+    half[part] = shiftLeftLimbs(half, a0, part, 1);
+    addLimbs(half, half, part + 1, a1, part);
+    shiftLeftLimbs(half, half, part + 1, 1);
+    addLimbs(half, half, part + 1, a2, part);
+    shiftLeftLimbs(half, half, part + 1, 1);
+    addLimbs(half, half, part + 1, a3, top);
+
+    return {negativeOne, negativeTwo};
+}
+
+// Toom-4 multiplication of equal size operands.
+//
+// Operands are split into four parts and evaluated at the points 0, 1, -1, 2, -2, 1/2 and
+// infinity, interpolation follows the same two's complement scheme as Toom-3. Equal operands
+// are evaluated once.
+static void multiplyToom4(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t size) {
+    auto part = (size + 3) / 4;
+    auto top = size - 3 * part;
+    auto width = 2 * part + 2;
+
+    ScratchLimbs workspace(10 * (part + 1) + 5 * width);
+
+    auto lhsOne = workspace.data();
+    auto lhsMinusOne = lhsOne + (part + 1);
+    auto lhsTwo = lhsMinusOne + (part + 1);
+    auto lhsMinusTwo = lhsTwo + (part + 1);
+    auto lhsHalf = lhsMinusTwo + (part + 1);
+    auto rhsOne = lhsHalf + (part + 1);
+    auto rhsMinusOne = rhsOne + (part + 1);
+    auto rhsTwo = rhsMinusOne + (part + 1);
+    auto rhsMinusTwo = rhsTwo + (part + 1);
+    auto rhsHalf = rhsMinusTwo + (part + 1);
+
+    auto one = rhsHalf + (part + 1);
+    auto minusOne = one + width;
+    auto two = minusOne + width;
+    auto minusTwo = two + width;
+    auto half = minusTwo + width;
+
+    auto [lhsNegativeOne, lhsNegativeTwo] =
+        evaluateToom4(lhsOne, lhsMinusOne, lhsTwo, lhsMinusTwo, lhsHalf, lhs, part, top);
+    auto [rhsNegativeOne, rhsNegativeTwo] = std::pair{lhsNegativeOne, lhsNegativeTwo};
+
+    if (lhs == rhs) {
+        rhsOne = lhsOne;
+        rhsMinusOne = lhsMinusOne;
+        rhsTwo = lhsTwo;
+        rhsMinusTwo = lhsMinusTwo;
+        rhsHalf = lhsHalf;
+    } else {
+        std::tie(rhsNegativeOne, rhsNegativeTwo) =
+            evaluateToom4(rhsOne, rhsMinusOne, rhsTwo, rhsMinusTwo, rhsHalf, rhs, part, top);
+    }
+
+    auto zero = result;
+    auto infinity = result + 6 * part;
+
+    multiply(zero, lhs, part, rhs, part);
+    multiply(infinity, lhs + 3 * part, top, rhs + 3 * part, top);
+    std::fill(result + 2 * part, result + 6 * part, Limb{});
+
+    multiplyEvaluated(one, width, lhsOne, rhsOne, part + 1, false);
+    multiplyEvaluated(minusOne, width, lhsMinusOne, rhsMinusOne, part + 1, lhsNegativeOne != rhsNegativeOne);
+    multiplyEvaluated(two, width, lhsTwo, rhsTwo, part + 1, false);
+    multiplyEvaluated(minusTwo, width, lhsMinusTwo, rhsMinusTwo, part + 1, lhsNegativeTwo != rhsNegativeTwo);
+    multiplyEvaluated(half, width, lhsHalf, rhsHalf, part + 1, false);
+
+    // c1 + c3 + c5
+    subtractLimbs(one, one, minusOne, width);
+    shiftRightLimbs(one, one, width, 1);
+
+    // c2 + c4
+    addLimbs(minusOne, minusOne, one, width);
+    subtractLimbs(minusOne, minusOne, width, zero, 2 * part);
+    subtractLimbs(minusOne, minusOne, width, infinity, 2 * top);
+
+    // c1 + 4 * c3 + 16 * c5
+    subtractLimbs(two, two, minusTwo, width);
+    shiftRightLimbs(two, two, width, 2);
+
+    // c2 + 4 * c4
+    addMultiplyLimb(minusTwo, two, width, 2);
+    subtractLimbs(minusTwo, minusTwo, width, zero, 2 * part);
+    subtractMultiple(minusTwo, width, infinity, 2 * top, 64);
+    shiftRightLimbs(minusTwo, minusTwo, width, 2);
+
+    // c4 and c2
+    subtractLimbs(minusTwo, minusTwo, minusOne, width);
+    divideExactLimb(minusTwo, minusTwo, width, 3);
+    subtractLimbs(minusOne, minusOne, minusTwo, width);
+
+    // 16 * c1 + 4 * c3 + c5
+    subtractMultiple(half, width, zero, 2 * part, 64);
+    subtractMultiple(half, width, minusOne, width, 16);
+    subtractMultiple(half, width, minusTwo, width, 4);
+    subtractLimbs(half, half, width, infinity, 2 * top);
+    shiftRightLimbs(half, half, width, 1);
+
+    // c3 + 5 * c5
+    subtractLimbs(two, two, one, width);
+    divideExactLimb(two, two, width, 3);
+
+    // 4 * c3 + 5 * c5
+    negateLimbs(half, width);
+    addMultiplyLimb(half, one, width, 16);
+    divideExactLimb(half, half, width, 3);
+
+    // c3, c5 and c1
+    subtractLimbs(half, half, two, width);
+    divideExactLimb(half, half, width, 3);
+    subtractLimbs(two, two, half, width);
+    divideExactLimb(two, two, width, 5);
+    subtractLimbs(one, one, half, width);
+    subtractLimbs(one, one, two, width);
+
+    addCoefficient(result, 2 * size, part, one, width);
+    addCoefficient(result, 2 * size, 2 * part, minusOne, width);
+    addCoefficient(result, 2 * size, 3 * part, half, width);
+    addCoefficient(result, 2 * size, 4 * part, minusTwo, width);
+    addCoefficient(result, 2 * size, 5 * part, two, width);
+}
+
+// Multiplies operands of equal not zero size, the result must not overlap the operands.
+// Equal operands are squared.
+static void multiplyBalanced(Limb* result, const Limb* lhs, const Limb* rhs, std::size_t size, Limb* scratch) {
+    if (lhs == rhs && size < squareThreshold) {
+        squareBasecase(result, lhs, size);
+    } else if (size < karatsubaThreshold) {
+        multiplyBasecase(result, lhs, size, rhs, size);
+    } else if (size < toom3Threshold) {
+        multiplyKaratsuba(result, lhs, rhs, size, scratch);
+    } else if (size < toom4Threshold) {
+        multiplyToom3(result, lhs, rhs, size);
+    } else {
+        multiplyToom4(result, lhs, rhs, size);
+    }
+}
+
+// Squares the not empty value into 2 * size limbs, the result must not overlap the value.
+static void square(Limb* result, const Limb* value, std::size_t size) {
+    if (size < squareThreshold) {
+        squareBasecase(result, value, size);
+        return;
+    }
+    if (size >= nttThreshold) {
+        multiplyNtt(result, value, size, value, size);
+        return;
+    }
+    ScratchLimbs scratch(multiplyScratchSize(size));
+    multiplyBalanced(result, value, value, size, scratch.data());
+}
+
+// Multiplies not empty operands into lhsSize + rhsSize limbs, the result must not overlap the operands.
+// Equal operands are squared.
+static void multiply(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) {
+    if (lhs == rhs && lhsSize == rhsSize) {
+        square(result, lhs, lhsSize);
+        return;
+    }
+    if (lhsSize < rhsSize) {
+        std::swap(lhs, rhs);
+        std::swap(lhsSize, rhsSize);
+    }
+    if (rhsSize < karatsubaThreshold) {
+        multiplyBasecase(result, lhs, lhsSize, rhs, rhsSize);
+        return;
+    }
+    if (rhsSize >= nttThreshold) {
+        multiplyNtt(result, lhs, lhsSize, rhs, rhsSize);
+        return;
+    }
+    ScratchLimbs scratch(multiplyScratchSize(rhsSize));
+    multiplyBalanced(result, lhs, rhs, rhsSize, scratch.data());
+
+    if (lhsSize == rhsSize) {
+        return;
+    }
+
+    // Unbalanced operands are multiplied by chunks of the longer one.
+    std::fill(result + 2 * rhsSize, result + lhsSize + rhsSize, Limb{});
+    ScratchLimbs product(2 * rhsSize);
+
+    std::size_t offset{rhsSize};
+
+    for (; lhsSize - offset >= rhsSize; offset += rhsSize) {
+        multiplyBalanced(product.data(), lhs + offset, rhs, rhsSize, scratch.data());
+        addLimbs(result + offset, result + offset, lhsSize + rhsSize - offset, product.data(), 2 * rhsSize);
+    }
+    if (offset < lhsSize) {
+        auto rest = lhsSize - offset;
+
+        multiply(product.data(), rhs, rhsSize, lhs + offset, rest);
+        addLimbs(result + offset, result + offset, lhsSize + rhsSize - offset, product.data(), rhsSize + rest);
+    }
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_MULTIPLICATION_H
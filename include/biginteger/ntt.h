@@ -0,0 +1,274 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_NTT_H
+#define ALEF_NUMERICS_BIGINTEGER_NTT_H
+
+#include "limb.h"
+#include "scratch.h"
+
+#include <algorithm>
+#include <array>
+
+namespace wingmann::numerics::__detail {
+
+// Prime modulus of the number theoretic transform, values are kept in Montgomery form.
+class NttPrime {
+    Limb modulus_;
+    Limb generator_;
+
+    // -modulus^(-1) mod 2^64.
+    Limb inverse_{};
+
+    // 2^128 mod modulus.
+    Limb square_{};
+
+public:
+    constexpr NttPrime(Limb modulus, Limb generator) : modulus_{modulus}, generator_{generator} {
+        Limb inverse{modulus};
+
+        for (int i = 0; i < 5; ++i) {
+            inverse *= 2 - modulus * inverse;
+        }
+        inverse_ = Limb{} - inverse;
+
+        Limb square = (~Limb{} % modulus + 1) % modulus;
+
+        for (unsigned i = 0; i < limbBits; ++i) {
+            square = add(square, square);
+        }
+        square_ = square;
+    }
+
+    [[nodiscard]]
+    constexpr Limb modulus() const { return modulus_; }
+
+    // Converts to Montgomery form, any limb value is accepted.
+    [[nodiscard]]
+    Limb toForm(Limb value) const { return multiply(value, square_); }
+
+    // Montgomery reduction of (high, low) < modulus * 2^64.
+    [[nodiscard]]
+    Limb reduce(Limb high, Limb low) const {
+        Limb productHigh;
+        multiplyLimbs(low * inverse_, modulus_, productHigh);
+
+        Limb value = high + productHigh + (low != 0);
+        return (value >= modulus_) ? (value - modulus_) : value;
+    }
+
+    // Montgomery product, the product of operands must be less than modulus * 2^64.
+    [[nodiscard]]
+    Limb multiply(Limb lhs, Limb rhs) const {
+        Limb high;
+        Limb low = multiplyLimbs(lhs, rhs, high);
+
+        return reduce(high, low);
+    }
+
+    [[nodiscard]]
+    constexpr Limb add(Limb lhs, Limb rhs) const {
+        Limb sum = lhs + rhs;
+        return (sum >= modulus_) ? (sum - modulus_) : sum;
+    }
+
+    [[nodiscard]]
+    constexpr Limb subtract(Limb lhs, Limb rhs) const {
+        return (lhs >= rhs) ? (lhs - rhs) : (lhs + modulus_ - rhs);
+    }
+
+    // Raises the value in Montgomery form to the power.
+    [[nodiscard]]
+    Limb power(Limb base, Limb exponent) const {
+        Limb result = toForm(1);
+
+        for (; exponent != 0; exponent >>= 1) {
+            if (exponent & 1) {
+                result = multiply(result, base);
+            }
+            base = multiply(base, base);
+        }
+        return result;
+    }
+
+    // Gets the primitive root of unity of the power of two order in Montgomery form.
+    [[nodiscard]]
+    Limb root(std::size_t order) const {
+        return power(toForm(generator_), (modulus_ - 1) / order);
+    }
+};
+
+// Primes k * 2^e + 1 below 2^62 with e >= 55. Their product exceeds 2^183, which bounds
+// the convolution of 64-bit limbs for every transform size the primes support.
+static constexpr std::array<NttPrime, 3> nttPrimes{
+    NttPrime{0x3A00'0000'0000'0001, 3},
+    NttPrime{0x2280'0000'0000'0001, 5},
+    NttPrime{0x1B00'0000'0000'0001, 5}
+};
+
+// Fills the table of twiddle factors, table[half + j] = root^(j * size / (2 * half)).
+static inline void nttRoots(Limb* table, std::size_t size, Limb root, const NttPrime& prime) {
+    auto half = size / 2;
+    auto power = prime.toForm(1);
+
+    for (std::size_t j = 0; j < half; ++j) {
+        table[half + j] = power;
+        power = prime.multiply(power, root);
+    }
+    for (half /= 2; half > 0; half /= 2) {
+        for (std::size_t j = 0; j < half; ++j) {
+            table[half + j] = table[2 * half + 2 * j];
+        }
+    }
+}
+
+// Decimation in frequency transform, takes natural order and gives bit reversed order.
+static inline void nttForward(Limb* values, std::size_t size, const Limb* roots, const NttPrime& prime) {
+    for (auto half = size / 2; half > 0; half /= 2) {
+        for (std::size_t start = 0; start < size; start += 2 * half) {
+            auto low = values + start;
+            auto high = low + half;
+
+            for (std::size_t j = 0; j < half; ++j) {
+                auto u = low[j];
+                auto v = high[j];
+
+                low[j] = prime.add(u, v);
+                high[j] = prime.multiply(prime.subtract(u, v), roots[half + j]);
+            }
+        }
+    }
+}
+
+// Decimation in time inverse transform without scaling, takes bit reversed order and gives
+// natural order.
+static inline void nttInverse(Limb* values, std::size_t size, const Limb* roots, const NttPrime& prime) {
+    for (std::size_t half = 1; half < size; half *= 2) {
+        for (std::size_t start = 0; start < size; start += 2 * half) {
+            auto low = values + start;
+            auto high = low + half;
+
+            for (std::size_t j = 0; j < half; ++j) {
+                auto u = low[j];
+                auto v = prime.multiply(high[j], roots[half + j]);
+
+                low[j] = prime.add(u, v);
+                high[j] = prime.subtract(u, v);
+            }
+        }
+    }
+}
+
+// Computes the cyclic convolution of operands modulo the prime, residues are returned in
+// ordinary form. The buffer and residues take size limbs each. Equal operands are transformed
+// once.
+static inline void nttConvolve(
+    Limb* residues,
+    Limb* buffer,
+    std::size_t size,
+    const Limb* lhs,
+    std::size_t lhsSize,
+    const Limb* rhs,
+    std::size_t rhsSize,
+    const NttPrime& prime)
+{
+    ScratchLimbs roots(size);
+    nttRoots(roots.data(), size, prime.root(size), prime);
+
+    const auto square = (lhs == rhs) && (lhsSize == rhsSize);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        residues[i] = (i < lhsSize) ? prime.toForm(lhs[i]) : Limb{};
+    }
+    nttForward(residues, size, roots.data(), prime);
+
+    if (!square) {
+        for (std::size_t i = 0; i < size; ++i) {
+            buffer[i] = (i < rhsSize) ? prime.toForm(rhs[i]) : Limb{};
+        }
+        nttForward(buffer, size, roots.data(), prime);
+    }
+    const auto factors = square ? residues : buffer;
+
+    for (std::size_t i = 0; i < size; ++i) {
+        residues[i] = prime.multiply(residues[i], factors[i]);
+    }
+    nttRoots(roots.data(), size, prime.power(prime.root(size), size - 1), prime);
+    nttInverse(residues, size, roots.data(), prime);
+
+    // Multiplication by plain size^(-1) scales and leaves Montgomery form at once.
+    auto scale = prime.multiply(prime.power(prime.toForm(size), prime.modulus() - 2), 1);
+
+    for (std::size_t i = 0; i < size; ++i) {
+        residues[i] = prime.multiply(residues[i], scale);
+    }
+}
+
+// Multiplies not empty operands into lhsSize + rhsSize limbs by number theoretic transforms
+// modulo three primes with the Chinese remainder recombination (Garner's algorithm).
+static void multiplyNtt(Limb* result, const Limb* lhs, std::size_t lhsSize, const Limb* rhs, std::size_t rhsSize) {
+    const auto& [first, second, third] = nttPrimes;
+
+    auto count = lhsSize + rhsSize - 1;
+    auto size = std::bit_ceil(count);
+
+    ScratchLimbs residues(3 * size);
+    ScratchLimbs buffer(size);
+
+    for (std::size_t i = 0; i < nttPrimes.size(); ++i) {
+        nttConvolve(residues.data() + i * size, buffer.data(), size, lhs, lhsSize, rhs, rhsSize, nttPrimes[i]);
+    }
+
+    // Garner's constants in Montgomery form.
+    auto inverse = [](const NttPrime& prime, Limb value) {
+        return prime.power(prime.toForm(value), prime.modulus() - 2);
+    };
+    auto firstBySecond = inverse(second, first.modulus());
+    auto secondByThird = inverse(third, second.modulus());
+    auto firstByThird = third.multiply(inverse(third, first.modulus()), secondByThird);
+
+    Limb carry0{};
+    Limb carry1{};
+    Limb carry2{};
+
+    for (std::size_t i = 0; i < lhsSize + rhsSize; ++i) {
+        if (i < count) {
+            auto r1 = residues[i];
+            auto r2 = residues[size + i];
+            auto r3 = residues[2 * size + i];
+
+            auto t2 = second.subtract(second.multiply(r2, firstBySecond), second.multiply(r1, firstBySecond));
+            auto t3 = third.subtract(
+                third.subtract(third.multiply(r3, firstByThird), third.multiply(r1, firstByThird)),
+                third.multiply(t2, secondByThird));
+
+            // x = r1 + p1 * (t2 + p2 * t3)
+            Limb innerHigh;
+            Limb innerLow = multiplyLimbs(t3, second.modulus(), innerHigh) + t2;
+            innerHigh += innerLow < t2;
+
+            Limb high;
+            Limb x0 = multiplyLimbs(innerLow, first.modulus(), high);
+            Limb x2;
+            Limb x1 = multiplyLimbs(innerHigh, first.modulus(), x2) + high;
+            x2 += x1 < high;
+
+            x0 += r1;
+            x1 += x0 < r1;
+            x2 += (x1 == 0) && (x0 < r1);
+
+            carry0 += x0;
+            Limb overflow = carry0 < x0;
+            carry1 += overflow;
+            overflow = carry1 < overflow;
+            carry1 += x1;
+            overflow += carry1 < x1;
+            carry2 += x2 + overflow;
+        }
+        result[i] = carry0;
+        carry0 = carry1;
+        carry1 = carry2;
+        carry2 = 0;
+    }
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_NTT_H
@@ -16,6 +16,47 @@ static BigInteger operator+(const BigInteger& lhs, const BigInteger& rhs) {
     return lhs.add(rhs);
 }
 
+/**
+ * @brief Adds value, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of addition.
+ */
+static BigInteger operator+(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.addAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Adds value, the buffer of the right operand is reused.
+ *
+ * The result takes the allocator of the left operand, so the buffer is reused if the allocators are equal.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of addition.
+ */
+static BigInteger operator+(const BigInteger& lhs, BigInteger&& rhs) {
+    if (rhs.get_allocator() != lhs.get_allocator()) {
+        return lhs.add(rhs);
+    }
+    rhs.addAssign(lhs);
+    return std::move(rhs);
+}
+
+/**
+ * @brief Adds value, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of addition.
+ */
+static BigInteger operator+(BigInteger&& lhs, BigInteger&& rhs) {
+    lhs.addAssign(rhs);
+    return std::move(lhs);
+}
+
 /**
  * @brief Subtracts value.
  *
@@ -27,6 +68,47 @@ static BigInteger operator-(const BigInteger& lhs, const BigInteger& rhs) {
     return lhs.subtract(rhs);
 }
 
+/**
+ * @brief Subtracts value, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of subtraction.
+ */
+static BigInteger operator-(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.subtractAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Subtracts value, the buffer of the right operand is reused.
+ *
+ * The result takes the allocator of the left operand, so the buffer is reused if the allocators are equal.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of subtraction.
+ */
+static BigInteger operator-(const BigInteger& lhs, BigInteger&& rhs) {
+    if (rhs.get_allocator() != lhs.get_allocator()) {
+        return lhs.subtract(rhs);
+    }
+    rhs.subtractAssign(lhs);
+    return std::move(rhs.negateAssign());
+}
+
+/**
+ * @brief Subtracts value, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of subtraction.
+ */
+static BigInteger operator-(BigInteger&& lhs, BigInteger&& rhs) {
+    lhs.subtractAssign(rhs);
+    return std::move(lhs);
+}
+
 /**
  * @brief Multiples value.
  *
@@ -38,6 +120,47 @@ static BigInteger operator*(const BigInteger& lhs, const BigInteger& rhs) {
     return lhs.multiply(rhs);
 }
 
+/**
+ * @brief Multiples value, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of multiplication.
+ */
+static BigInteger operator*(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.multiplyAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Multiples value, the buffer of the right operand is reused.
+ *
+ * The result takes the allocator of the left operand, so the buffer is reused if the allocators are equal.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of multiplication.
+ */
+static BigInteger operator*(const BigInteger& lhs, BigInteger&& rhs) {
+    if (rhs.get_allocator() != lhs.get_allocator()) {
+        return lhs.multiply(rhs);
+    }
+    rhs.multiplyAssign(lhs);
+    return std::move(rhs);
+}
+
+/**
+ * @brief Multiples value, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of multiplication.
+ */
+static BigInteger operator*(BigInteger&& lhs, BigInteger&& rhs) {
+    lhs.multiplyAssign(rhs);
+    return std::move(lhs);
+}
+
 /**
  * @brief Divides value.
  *
@@ -49,6 +172,18 @@ static BigInteger operator/(const BigInteger& lhs, const BigInteger& rhs) {
     return lhs.divide(rhs);
 }
 
+/**
+ * @brief Divides value, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of division.
+ */
+static BigInteger operator/(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.divideAssign(rhs);
+    return std::move(lhs);
+}
+
 /**
  * @brief Computes remainder.
  *
@@ -60,6 +195,18 @@ static BigInteger operator%(const BigInteger& lhs, const BigInteger& rhs) {
     return lhs.mod(rhs);
 }
 
+/**
+ * @brief Computes remainder, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Remainder of division current value by right side value.
+ */
+static BigInteger operator%(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.modAssign(rhs);
+    return std::move(lhs);
+}
+
 /**
  * @brief Adds the right operand to the current value and assigns the result.
  *
@@ -67,8 +214,7 @@ static BigInteger operator%(const BigInteger& lhs, const BigInteger& rhs) {
  * @return    Modified object.
  */
 static BigInteger& operator+=(BigInteger& lhs, const BigInteger& rhs) {
-    lhs = lhs + rhs;
-    return lhs;
+    return lhs.addAssign(rhs);
 }
 
 /**
@@ -78,8 +224,7 @@ static BigInteger& operator+=(BigInteger& lhs, const BigInteger& rhs) {
  * @return    Modified object.
  */
 static BigInteger& operator-=(BigInteger& lhs, const BigInteger& rhs) {
-    lhs = lhs - rhs;
-    return lhs;
+    return lhs.subtractAssign(rhs);
 }
 
 /**
@@ -89,8 +234,7 @@ static BigInteger& operator-=(BigInteger& lhs, const BigInteger& rhs) {
  * @return    Modified object.
  */
 static BigInteger& operator*=(BigInteger& lhs, const BigInteger& rhs) {
-    lhs = lhs * rhs;
-    return lhs;
+    return lhs.multiplyAssign(rhs);
 }
 
 /**
@@ -100,8 +244,7 @@ static BigInteger& operator*=(BigInteger& lhs, const BigInteger& rhs) {
  * @return    Modified object.
  */
 static BigInteger& operator/=(BigInteger& lhs, const BigInteger& rhs) {
-    lhs = lhs / rhs;
-    return lhs;
+    return lhs.divideAssign(rhs);
 }
 
 /**
@@ -111,15 +254,221 @@ static BigInteger& operator/=(BigInteger& lhs, const BigInteger& rhs) {
  * @return    Modified object.
  */
 static BigInteger& operator%=(BigInteger& lhs, const BigInteger& rhs) {
-    lhs = lhs % rhs;
-    return lhs;
+    return lhs.modAssign(rhs);
+}
+
+/**
+ * @brief Computes bitwise AND in two's complement form.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise AND.
+ */
+static BigInteger operator&(const BigInteger& lhs, const BigInteger& rhs) {
+    return lhs.bitwiseAnd(rhs);
+}
+
+/**
+ * @brief Computes bitwise AND in two's complement form, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise AND.
+ */
+static BigInteger operator&(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.bitwiseAndAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Computes bitwise AND in two's complement form, the buffer of the right operand is reused.
+ *
+ * The result takes the allocator of the left operand, so the buffer is reused if the allocators are equal.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise AND.
+ */
+static BigInteger operator&(const BigInteger& lhs, BigInteger&& rhs) {
+    if (rhs.get_allocator() != lhs.get_allocator()) {
+        return lhs.bitwiseAnd(rhs);
+    }
+    rhs.bitwiseAndAssign(lhs);
+    return std::move(rhs);
+}
+
+/**
+ * @brief Computes bitwise AND in two's complement form, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise AND.
+ */
+static BigInteger operator&(BigInteger&& lhs, BigInteger&& rhs) {
+    lhs.bitwiseAndAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Computes bitwise OR in two's complement form.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise OR.
+ */
+static BigInteger operator|(const BigInteger& lhs, const BigInteger& rhs) {
+    return lhs.bitwiseOr(rhs);
+}
+
+/**
+ * @brief Computes bitwise OR in two's complement form, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise OR.
+ */
+static BigInteger operator|(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.bitwiseOrAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Computes bitwise OR in two's complement form, the buffer of the right operand is reused.
+ *
+ * The result takes the allocator of the left operand, so the buffer is reused if the allocators are equal.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise OR.
+ */
+static BigInteger operator|(const BigInteger& lhs, BigInteger&& rhs) {
+    if (rhs.get_allocator() != lhs.get_allocator()) {
+        return lhs.bitwiseOr(rhs);
+    }
+    rhs.bitwiseOrAssign(lhs);
+    return std::move(rhs);
+}
+
+/**
+ * @brief Computes bitwise OR in two's complement form, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise OR.
+ */
+static BigInteger operator|(BigInteger&& lhs, BigInteger&& rhs) {
+    lhs.bitwiseOrAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Computes bitwise XOR in two's complement form.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise XOR.
+ */
+static BigInteger operator^(const BigInteger& lhs, const BigInteger& rhs) {
+    return lhs.bitwiseXor(rhs);
+}
+
+/**
+ * @brief Computes bitwise XOR in two's complement form, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise XOR.
+ */
+static BigInteger operator^(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.bitwiseXorAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Computes bitwise XOR in two's complement form, the buffer of the right operand is reused.
+ *
+ * The result takes the allocator of the left operand, so the buffer is reused if the allocators are equal.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise XOR.
+ */
+static BigInteger operator^(const BigInteger& lhs, BigInteger&& rhs) {
+    if (rhs.get_allocator() != lhs.get_allocator()) {
+        return lhs.bitwiseXor(rhs);
+    }
+    rhs.bitwiseXorAssign(lhs);
+    return std::move(rhs);
+}
+
+/**
+ * @brief Computes bitwise XOR in two's complement form, the buffer of the left operand is reused.
+ *
+ * @param lhs The left operand.
+ * @param rhs The right operand.
+ * @return    Result of bitwise XOR.
+ */
+static BigInteger operator^(BigInteger&& lhs, BigInteger&& rhs) {
+    lhs.bitwiseXorAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Computes bitwise NOT in two's complement form.
+ *
+ * @param value The operand.
+ * @return      Result of bitwise NOT.
+ */
+static BigInteger operator~(const BigInteger& value) {
+    return value.bitwiseNot();
+}
+
+/**
+ * @brief Computes bitwise NOT in two's complement form, the buffer of the operand is reused.
+ *
+ * @param value The operand.
+ * @return      Result of bitwise NOT.
+ */
+static BigInteger operator~(BigInteger&& value) {
+    --value.negateAssign();
+    return std::move(value);
+}
+
+/**
+ * @brief Computes bitwise AND with the right operand and assigns the result.
+ *
+ * @param rhs The right operand.
+ * @return    Modified object.
+ */
+static BigInteger& operator&=(BigInteger& lhs, const BigInteger& rhs) {
+    return lhs.bitwiseAndAssign(rhs);
+}
+
+/**
+ * @brief Computes bitwise OR with the right operand and assigns the result.
+ *
+ * @param rhs The right operand.
+ * @return    Modified object.
+ */
+static BigInteger& operator|=(BigInteger& lhs, const BigInteger& rhs) {
+    return lhs.bitwiseOrAssign(rhs);
+}
+
+/**
+ * @brief Computes bitwise XOR with the right operand and assigns the result.
+ *
+ * @param rhs The right operand.
+ * @return    Modified object.
+ */
+static BigInteger& operator^=(BigInteger& lhs, const BigInteger& rhs) {
+    return lhs.bitwiseXorAssign(rhs);
 }
 
 /**
  * @brief Shifts the current value to left on right operand value.
  *
- * @param lhs The value to be moved to the right.
- * @param rhs The value to shift right on.
+ * @param lhs The value to be moved to the left.
+ * @param rhs The value to shift left on.
  * @return    Shifted current value.
  */
 static BigInteger operator<<(const BigInteger& lhs, const BigInteger& rhs) {
@@ -127,36 +476,144 @@ static BigInteger operator<<(const BigInteger& lhs, const BigInteger& rhs) {
 }
 
 /**
- * @brief Shifts the current value to right on right operand value.
+ * @brief Shifts the current value to left on right operand value, the buffer of the left
+ *        operand is reused.
  *
  * @param lhs The value to be moved to the left.
  * @param rhs The value to shift left on.
  * @return    Shifted current value.
  */
+static BigInteger operator<<(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.shiftLeftAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Shifts the current value to left on right operand count of bits.
+ *
+ * @param lhs The value to be moved to the left.
+ * @param rhs The count of bits to shift left on.
+ * @return    Shifted current value.
+ */
+template<typename T>
+requires std::integral<T> && (!std::same_as<T, bool>)
+static BigInteger operator<<(const BigInteger& lhs, T rhs) {
+    return lhs.shiftLeft(rhs);
+}
+
+/**
+ * @brief Shifts the current value to left on right operand count of bits, the buffer of the
+ *        left operand is reused.
+ *
+ * @param lhs The value to be moved to the left.
+ * @param rhs The count of bits to shift left on.
+ * @return    Shifted current value.
+ */
+template<typename T>
+requires std::integral<T> && (!std::same_as<T, bool>)
+static BigInteger operator<<(BigInteger&& lhs, T rhs) {
+    lhs.shiftLeftAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Shifts the current value to right on right operand value.
+ *
+ * @param lhs The value to be moved to the right.
+ * @param rhs The value to shift right on.
+ * @return    Shifted current value.
+ */
 static BigInteger operator>>(const BigInteger& lhs, const BigInteger& rhs) {
     return lhs.shiftRight(rhs);
 }
 
 /**
- * @brief Shifts the current value to left on right operand value and assigns the result.
+ * @brief Shifts the current value to right on right operand value, the buffer of the left
+ *        operand is reused.
  *
- * @param lhs The value to shiftRight on.
+ * @param lhs The value to be moved to the right.
+ * @param rhs The value to shift right on.
+ * @return    Shifted current value.
+ */
+static BigInteger operator>>(BigInteger&& lhs, const BigInteger& rhs) {
+    lhs.shiftRightAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Shifts the current value to right on right operand count of bits.
+ *
+ * @param lhs The value to be moved to the right.
+ * @param rhs The count of bits to shift right on.
+ * @return    Shifted current value.
+ */
+template<typename T>
+requires std::integral<T> && (!std::same_as<T, bool>)
+static BigInteger operator>>(const BigInteger& lhs, T rhs) {
+    return lhs.shiftRight(rhs);
+}
+
+/**
+ * @brief Shifts the current value to right on right operand count of bits, the buffer of the
+ *        left operand is reused.
+ *
+ * @param lhs The value to be moved to the right.
+ * @param rhs The count of bits to shift right on.
+ * @return    Shifted current value.
+ */
+template<typename T>
+requires std::integral<T> && (!std::same_as<T, bool>)
+static BigInteger operator>>(BigInteger&& lhs, T rhs) {
+    lhs.shiftRightAssign(rhs);
+    return std::move(lhs);
+}
+
+/**
+ * @brief Shifts the current value to left on right operand value in place.
+ *
+ * @param lhs The value to shift left.
+ * @param rhs The value to shift left on.
  * @return    Modified object.
  */
 static BigInteger& operator<<=(BigInteger& lhs, const BigInteger& rhs) {
-    lhs = lhs << rhs;
-    return lhs;
+    return lhs.shiftLeftAssign(rhs);
 }
 
 /**
- * @brief Shifts the current value to left on right operand value and assigns the result.
+ * @brief Shifts the current value to left on right operand count of bits in place.
  *
- * @param lhs The value to shiftRight on.
- * @param rhs Modified object.
+ * @param lhs The value to shift left.
+ * @param rhs The count of bits to shift left on.
+ * @return    Modified object.
+ */
+template<typename T>
+requires std::integral<T> && (!std::same_as<T, bool>)
+static BigInteger& operator<<=(BigInteger& lhs, T rhs) {
+    return lhs.shiftLeftAssign(rhs);
+}
+
+/**
+ * @brief Shifts the current value to right on right operand value in place.
+ *
+ * @param lhs The value to shift right.
+ * @param rhs The value to shift right on.
+ * @return    Modified object.
  */
 static BigInteger& operator>>=(BigInteger& lhs, const BigInteger& rhs) {
-    lhs = lhs >> rhs;
-    return lhs;
+    return lhs.shiftRightAssign(rhs);
+}
+
+/**
+ * @brief Shifts the current value to right on right operand count of bits in place.
+ *
+ * @param lhs The value to shift right.
+ * @param rhs The count of bits to shift right on.
+ * @return    Modified object.
+ */
+template<typename T>
+requires std::integral<T> && (!std::same_as<T, bool>)
+static BigInteger& operator>>=(BigInteger& lhs, T rhs) {
+    return lhs.shiftRightAssign(rhs);
 }
 
 /**
@@ -0,0 +1,436 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_PRIME_H
+#define ALEF_NUMERICS_BIGINTEGER_PRIME_H
+
+#include "limb.h"
+#include "modular.h"
+#include "root.h"
+#include "scratch.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+namespace wingmann::numerics::__detail {
+
+// Bound of the small primes used for trial division and sieving.
+static constexpr std::size_t smallPrimeBound = 2048;
+
+// Gets the count of odd primes below the bound.
+static constexpr std::size_t countSmallPrimes() {
+    std::array<bool, smallPrimeBound> composite{};
+    std::size_t count{};
+
+    for (std::size_t i = 3; i < smallPrimeBound; i += 2) {
+        if (composite[i]) {
+            continue;
+        }
+        ++count;
+
+        for (auto j = i * i; j < smallPrimeBound; j += 2 * i) {
+            composite[j] = true;
+        }
+    }
+    return count;
+}
+
+// Odd primes below the bound in the ascending order.
+static constexpr auto smallPrimes = [] {
+    std::array<bool, smallPrimeBound> composite{};
+    std::array<Limb, countSmallPrimes()> primes{};
+    std::size_t count{};
+
+    for (std::size_t i = 3; i < smallPrimeBound; i += 2) {
+        if (composite[i]) {
+            continue;
+        }
+        primes[count++] = i;
+
+        for (auto j = i * i; j < smallPrimeBound; j += 2 * i) {
+            composite[j] = true;
+        }
+    }
+    return primes;
+}();
+
+// Gets the count of groups of consecutive small primes with the product fitting into a limb.
+static constexpr std::size_t countPrimeGroups() {
+    std::size_t count{};
+    Limb product{1};
+
+    for (auto prime : smallPrimes) {
+        if (product > ~Limb{} / prime) {
+            ++count;
+            product = 1;
+        }
+        product *= prime;
+    }
+    return count + 1;
+}
+
+// Consecutive small primes [first, last) of the table with their product fitting into a limb, a
+// single remainder by the product gives the remainders by all primes of the group.
+struct PrimeGroup {
+    Limb product;
+    std::size_t first;
+    std::size_t last;
+};
+
+static constexpr auto primeGroups = [] {
+    std::array<PrimeGroup, countPrimeGroups()> groups{};
+    std::size_t count{};
+    PrimeGroup group{1, 0, 0};
+
+    for (std::size_t i = 0; i < smallPrimes.size(); ++i) {
+        if (group.product > ~Limb{} / smallPrimes[i]) {
+            group.last = i;
+            groups[count++] = group;
+            group = {1, i, i};
+        }
+        group.product *= smallPrimes[i];
+    }
+    group.last = smallPrimes.size();
+    groups[count] = group;
+
+    return groups;
+}();
+
+// Gets the remainder of the value by the limb.
+static inline Limb remainderLimb(const Limb* value, std::size_t size, Limb divisor) {
+    // The value is normalized together with the divisor on the fly.
+    auto shift = static_cast<unsigned>(std::countl_zero(divisor));
+    divisor <<= shift;
+
+    auto reciprocal = reciprocalLimb(divisor);
+    Limb remainder = (shift != 0 && size > 0) ? (value[size - 1] >> (limbBits - shift)) : Limb{};
+
+    while (size-- > 0) {
+        Limb limb = value[size] << shift;
+
+        if (shift != 0 && size > 0) {
+            limb |= value[size - 1] >> (limbBits - shift);
+        }
+        divideLimbs(remainder, limb, divisor, reciprocal, remainder);
+    }
+    return remainder >> shift;
+}
+
+// Calls the visitor with every small prime and the remainder of the value by it.
+template<typename Visitor>
+static void visitSmallPrimes(const Limb* value, std::size_t size, Visitor&& visit) {
+    for (const auto& group : primeGroups) {
+        auto remainder = remainderLimb(value, size, group.product);
+
+        for (auto i = group.first; i < group.last; ++i) {
+            visit(i, remainder % smallPrimes[i]);
+        }
+    }
+}
+
+// Checks the trimmed value for a small prime factor other than the value itself.
+static inline bool hasSmallFactor(const Limb* value, std::size_t size) {
+    bool found{};
+
+    visitSmallPrimes(value, size, [&](std::size_t index, Limb remainder) {
+        found = found || (remainder == 0 && (size > 1 || value[0] != smallPrimes[index]));
+    });
+    return found;
+}
+
+// Jacobi symbol (value / modulus) of the odd modulus.
+static constexpr int jacobiLimb(Limb value, Limb modulus) {
+    int result{1};
+    value %= modulus;
+
+    while (value != 0) {
+        auto zeros = std::countr_zero(value);
+        value >>= zeros;
+
+        // (2 / modulus) = -1 for the modulus 3 or 5 mod 8.
+        if ((zeros & 1) != 0 && ((modulus & 7) == 3 || (modulus & 7) == 5)) {
+            result = -result;
+        }
+        // Quadratic reciprocity of odd values.
+        if ((value & 3) == 3 && (modulus & 3) == 3) {
+            result = -result;
+        }
+        std::swap(value, modulus);
+        value %= modulus;
+    }
+    return (modulus == 1) ? result : 0;
+}
+
+// Jacobi symbol (number / value) of the small odd number and the odd value.
+static inline int jacobiSmall(std::int64_t number, const Limb* value, std::size_t size) {
+    auto magnitude = static_cast<Limb>((number < 0) ? -number : number);
+    auto result = jacobiLimb(remainderLimb(value, size, magnitude), magnitude);
+
+    // Reciprocity turns (|number| / value) to (value / |number|), (-1 / value) = -1 for the value
+    // 3 mod 4.
+    if ((magnitude & 3) == 3 && (value[0] & 3) == 3) {
+        result = -result;
+    }
+    if (number < 0 && (value[0] & 3) == 3) {
+        result = -result;
+    }
+    return result;
+}
+
+// Shifts out the trailing zero bits of the trimmed not zero value in place, returns their count
+// and updates the size.
+static inline std::size_t removeTrailingZeros(Limb* value, std::size_t& size) {
+    std::size_t limbs{};
+
+    while (value[limbs] == 0) {
+        ++limbs;
+    }
+    auto bits = static_cast<unsigned>(std::countr_zero(value[limbs]));
+
+    if (bits != 0) {
+        shiftRightLimbs(value, value + limbs, size - limbs, bits);
+    } else {
+        std::copy(value + limbs, value + size, value);
+    }
+    size = trimmedSize(value, size - limbs);
+
+    return limbs * limbBits + bits;
+}
+
+// Sets the value to the small constant in the Montgomery form of the odd modulus.
+static inline void montgomeryForm(Limb* result, std::int64_t number, const Limb* modulus, std::size_t size) {
+    auto magnitude = static_cast<Limb>((number < 0) ? -number : number);
+    reduceShifted(result, &magnitude, 1, size, modulus, size);
+
+    if (number < 0 && trimmedSize(result, size) != 0) {
+        subtractLimbs(result, modulus, result, size);
+    }
+}
+
+// Adds values below the modulus modulo the modulus, the result may alias the operands.
+static inline void addModulo(Limb* result, const Limb* lhs, const Limb* rhs, const Limb* modulus, std::size_t size) {
+    auto carry = addLimbs(result, lhs, rhs, size);
+
+    if (carry != 0 || compareLimbs(result, modulus, size) >= 0) {
+        subtractLimbs(result, result, modulus, size);
+    }
+}
+
+// Subtracts values below the modulus modulo the modulus, the result may alias the operands.
+static inline void subtractModulo(
+    Limb* result,
+    const Limb* lhs,
+    const Limb* rhs,
+    const Limb* modulus,
+    std::size_t size)
+{
+    if (subtractLimbs(result, lhs, rhs, size) != 0) {
+        addLimbs(result, result, modulus, size);
+    }
+}
+
+// Checks whether the value is zero.
+static inline bool isZero(const Limb* value, std::size_t size) {
+    return trimmedSize(value, size) == 0;
+}
+
+// Multiplies the value below the modulus by the small number modulo the modulus, the Montgomery
+// form of the value is kept. The result may alias the value.
+static inline void multiplySmallModulo(
+    Limb* result,
+    const Limb* value,
+    std::int64_t number,
+    const Limb* modulus,
+    std::size_t size)
+{
+    ScratchLimbs product(size + 1);
+    product[size] = multiplyLimb(product.data(), value, size, static_cast<Limb>((number < 0) ? -number : number));
+
+    reduceShifted(result, product.data(), product.size(), 0, modulus, size);
+
+    if (number < 0 && !isZero(result, size)) {
+        subtractLimbs(result, modulus, result, size);
+    }
+}
+
+// Strong probable prime test of the odd trimmed value above the base to the base.
+static bool isStrongProbablePrime(const Limb* value, std::size_t size, Limb base) {
+    // value - 1 = exponent * 2^twos with the odd exponent.
+    ScratchLimbs exponent(value, value + size);
+    subtractLimb(exponent.data(), exponent.data(), size, 1);
+
+    auto exponentSize = size;
+    auto twos = removeTrailingZeros(exponent.data(), exponentSize);
+
+    const auto inverse = montgomeryInverse(value[0]);
+    ScratchLimbs product(2 * size);
+
+    auto step = [&](Limb* stepResult, const Limb* lhs, const Limb* rhs) {
+        montgomeryMultiply(stepResult, lhs, rhs, value, size, inverse, product.data());
+    };
+    ScratchLimbs one(size);
+    ScratchLimbs minusOne(size);
+    ScratchLimbs form(size);
+    ScratchLimbs power(size);
+
+    montgomeryForm(one.data(), 1, value, size);
+    montgomeryForm(minusOne.data(), -1, value, size);
+    montgomeryForm(form.data(), static_cast<std::int64_t>(base), value, size);
+
+    powerWindow(power.data(), form.data(), size, exponent.data(), exponentSize, step);
+
+    if (compareLimbs(power.data(), one.data(), size) == 0) {
+        return true;
+    }
+    for (std::size_t i = 0; i < twos; ++i) {
+        if (compareLimbs(power.data(), minusOne.data(), size) == 0) {
+            return true;
+        }
+        step(power.data(), power.data(), power.data());
+    }
+    return false;
+}
+
+// Strong Lucas probable prime test of the odd trimmed value above the small primes with the
+// parameters of Selfridge: D is the first of 5, -7, 9, -11, ... with (D / value) = -1, P = 1 and
+// Q = (1 - D) / 4.
+static bool isStrongLucasProbablePrime(const Limb* value, std::size_t size) {
+    std::int64_t discriminant{5};
+
+    for (;; discriminant = (discriminant > 0) ? -(discriminant + 2) : (2 - discriminant)) {
+        auto symbol = jacobiSmall(discriminant, value, size);
+
+        if (symbol == -1) {
+            break;
+        }
+        if (symbol == 0) {
+            return false;
+        }
+        // The symbol is never -1 for squares.
+        if (discriminant == 13) {
+            Limbs root;
+            Limbs remainder;
+            sqrtRemainder(root, remainder, value, size);
+
+            if (remainder.empty()) {
+                return false;
+            }
+        }
+    }
+    // value + 1 = exponent * 2^twos with the odd exponent.
+    ScratchLimbs exponent(size + 1);
+    std::copy(value, value + size, exponent.data());
+    addLimb(exponent.data(), exponent.data(), size + 1, 1);
+
+    auto exponentSize = trimmedSize(exponent.data(), size + 1);
+    auto twos = removeTrailingZeros(exponent.data(), exponentSize);
+
+    const auto inverse = montgomeryInverse(value[0]);
+    const auto q = (1 - discriminant) / 4;
+
+    ScratchLimbs product(2 * size);
+    ScratchLimbs v(size);
+    ScratchLimbs nextV(size);
+    ScratchLimbs powerQ(size);
+    ScratchLimbs nextQ(size);
+
+    auto multiplyStep = [&](Limb* result, const Limb* lhs, const Limb* rhs) {
+        montgomeryMultiply(result, lhs, rhs, value, size, inverse, product.data());
+    };
+    // V_(j+k) = V_j V_k - Q^k V_(j-k) with P = 1, U is never taken: V_2k = V_k^2 - 2 Q^k and
+    // V_(2k+1) = V_k V_(k+1) - Q^k.
+    auto doubleV = [&](Limb* target, const Limb* source, const Limb* power) {
+        multiplyStep(target, source, source);
+        subtractModulo(target, target, power, value, size);
+        subtractModulo(target, target, power, value, size);
+    };
+    auto bits = exponentSize * limbBits - static_cast<std::size_t>(std::countl_zero(exponent[exponentSize - 1]));
+
+    // V_0 = 2, V_1 = P = 1, Q^0 = 1 in the Montgomery form.
+    montgomeryForm(v.data(), 2, value, size);
+    montgomeryForm(nextV.data(), 1, value, size);
+    montgomeryForm(powerQ.data(), 1, value, size);
+
+    for (auto position = bits; position-- > 0;) {
+        if (testBit(exponent.data(), position)) {
+            // k -> 2k + 1: V_(2k+1), V_(2k+2) = V_(k+1)^2 - 2 Q^(k+1), Q^(2k+1).
+            multiplyStep(v.data(), v.data(), nextV.data());
+            subtractModulo(v.data(), v.data(), powerQ.data(), value, size);
+
+            multiplySmallModulo(nextQ.data(), powerQ.data(), q, value, size);
+            doubleV(nextV.data(), nextV.data(), nextQ.data());
+
+            multiplyStep(powerQ.data(), powerQ.data(), powerQ.data());
+            multiplySmallModulo(powerQ.data(), powerQ.data(), q, value, size);
+        } else {
+            // k -> 2k: V_(2k+1), V_2k, Q^2k.
+            multiplyStep(nextV.data(), v.data(), nextV.data());
+            subtractModulo(nextV.data(), nextV.data(), powerQ.data(), value, size);
+
+            doubleV(v.data(), v.data(), powerQ.data());
+            multiplyStep(powerQ.data(), powerQ.data(), powerQ.data());
+        }
+    }
+    // D U_k = 2 V_(k+1) - P V_k, D is coprime to the value.
+    addModulo(nextV.data(), nextV.data(), nextV.data(), value, size);
+    subtractModulo(nextV.data(), nextV.data(), v.data(), value, size);
+
+    if (isZero(nextV.data(), size) || isZero(v.data(), size)) {
+        return true;
+    }
+    for (std::size_t i = 1; i < twos; ++i) {
+        doubleV(v.data(), v.data(), powerQ.data());
+
+        if (isZero(v.data(), size)) {
+            return true;
+        }
+        multiplyStep(powerQ.data(), powerQ.data(), powerQ.data());
+    }
+    return false;
+}
+
+// Probable prime test of the trimmed value by trial division, the Baillie-PSW test and the given
+// count of extra Miller-Rabin rounds to the bases of the small primes.
+static bool isProbablePrime(const Limb* value, std::size_t size, std::size_t rounds) {
+    if (size == 0 || (size == 1 && value[0] < 3)) {
+        return size == 1 && value[0] == 2;
+    }
+    if ((value[0] & 1) == 0 || hasSmallFactor(value, size)) {
+        return false;
+    }
+    // Values without factors below the bound are prime up to its square.
+    if (size == 1 && value[0] < smallPrimeBound * smallPrimeBound) {
+        return true;
+    }
+    if (!isStrongProbablePrime(value, size, 2) || !isStrongLucasProbablePrime(value, size)) {
+        return false;
+    }
+    for (std::size_t i = 0; i < std::min(rounds, smallPrimes.size()); ++i) {
+        if (!isStrongProbablePrime(value, size, smallPrimes[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Count of odd candidates sieved at once by the next prime search.
+static constexpr std::size_t primeSieveSize = 1024;
+
+// Marks the odd candidates value + 2 * i of the window divisible by the small primes, the value is
+// odd and above the small primes.
+static inline void sievePrimes(std::array<bool, primeSieveSize>& composite, const Limb* value, std::size_t size) {
+    composite.fill(false);
+
+    visitSmallPrimes(value, size, [&](std::size_t index, Limb remainder) {
+        // value + 2 * i = 0 mod prime for i = -remainder / 2 mod prime.
+        auto prime = smallPrimes[index];
+        auto first = ((prime - remainder) % prime) * ((prime + 1) / 2) % prime;
+
+        for (auto i = first; i < primeSieveSize; i += prime) {
+            composite[i] = true;
+        }
+    });
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_PRIME_H
@@ -0,0 +1,190 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_ROOT_H
+#define ALEF_NUMERICS_BIGINTEGER_ROOT_H
+
+#include "division.h"
+#include "limb.h"
+#include "multiplication.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace wingmann::numerics::__detail {
+
+// Square root of the double limb value with the high limb at least B / 4. The remainder
+// value - root^2 is at most 2 * root, its bit above the limb is returned.
+static inline Limb sqrtDoubleLimb(Limb high, Limb low, Limb& remainder, bool& remainderHigh) {
+    auto fits = [&](Limb root) {
+        Limb squareHigh;
+        auto squareLow = multiplyLimbs(root, root, squareHigh);
+
+        return squareHigh < high || (squareHigh == high && squareLow <= low);
+    };
+    constexpr auto lowest = Limb{1} << (limbBits - 1);
+    constexpr auto highest = ~Limb{};
+    constexpr auto margin = Limb{1} << 13;
+
+    // The floating estimate has 52 correct bits, the root is searched near it.
+    auto estimate = std::sqrt(std::ldexp(static_cast<double>(high), limbBits) + static_cast<double>(low));
+    auto guess = (estimate >= std::ldexp(1.0, limbBits)) ? highest : static_cast<Limb>(estimate);
+
+    auto first = std::max(lowest, (guess > lowest + margin) ? guess - margin : lowest);
+    auto last = (guess < highest - margin) ? guess + margin : highest;
+
+    if (!fits(first)) {
+        first = lowest;
+    }
+    if (last != highest && fits(last + 1)) {
+        last = highest;
+    }
+    while (first < last) {
+        auto middle = last - (last - first) / 2;
+
+        if (fits(middle)) {
+            first = middle;
+        } else {
+            last = middle - 1;
+        }
+    }
+    Limb squareHigh;
+    auto squareLow = multiplyLimbs(first, first, squareHigh);
+
+    remainder = low - squareLow;
+    remainderHigh = (high - squareHigh - static_cast<Limb>(low < squareLow)) != 0;
+
+    return first;
+}
+
+// Adds the value to the trimmed result.
+static inline void addToRoot(Limbs& result, const Limb* value, std::size_t size) {
+    result.resize(std::max(result.size(), size) + 1);
+    addLimbs(result.data(), result.data(), result.size(), value, size);
+    trim(result);
+}
+
+// Square root of the normalized value of 2 * size limbs with the leading limb at least B / 4 by
+// Zimmermann's Karatsuba square root. The root takes size limbs, the remainder value - root^2 is
+// at most 2 * root. Both results are trimmed.
+static void sqrtNormalized(Limbs& root, Limbs& remainder, const Limb* value, std::size_t size) {
+    if (size == 1) {
+        Limb rest;
+        bool restHigh;
+
+        root.resize(1);
+        root[0] = sqrtDoubleLimb(value[1], value[0], rest, restHigh);
+
+        remainder.resize(2);
+        remainder[0] = rest;
+        remainder[1] = restHigh ? 1 : 0;
+        trim(remainder);
+        return;
+    }
+    auto low = size / 2;
+    auto high = size - low;
+
+    // The leading half of the value gives the leading half of the root.
+    Limbs rootHigh;
+    Limbs remainderHigh;
+    sqrtNormalized(rootHigh, remainderHigh, value + 2 * low, high);
+
+    // The next limbs of the root are (remainderHigh * B^low + value[low, 2 * low)) / (2 * rootHigh)
+    // taken as the quotient by rootHigh halved.
+    Limbs numerator(low + remainderHigh.size());
+    std::copy(value + low, value + 2 * low, numerator.begin());
+    std::copy(remainderHigh.begin(), remainderHigh.end(), numerator.begin() + low);
+    trim(numerator);
+
+    Limbs quotient;
+    Limbs rest;
+
+    if (compareLimbs(numerator.data(), numerator.size(), rootHigh.data(), rootHigh.size()) < 0) {
+        rest = numerator;
+    } else {
+        quotient.resize(numerator.size() - rootHigh.size() + 1);
+        rest.resize(rootHigh.size());
+
+        divide(quotient.data(), rest.data(), numerator.data(), numerator.size(), rootHigh.data(), rootHigh.size());
+        trim(rest);
+
+        auto odd = (quotient[0] & 1) != 0;
+        shiftRightLimbs(quotient.data(), quotient.data(), quotient.size(), 1);
+        trim(quotient);
+
+        if (odd) {
+            addToRoot(rest, rootHigh.data(), rootHigh.size());
+        }
+    }
+
+    // The quotient may reach B^low, so the root is summed.
+    root.resize(size + 1);
+    std::fill(root.begin(), root.end(), Limb{});
+    std::copy(quotient.begin(), quotient.end(), root.begin());
+    addLimbs(root.data() + low, root.data() + low, size + 1 - low, rootHigh.data(), rootHigh.size());
+    trim(root);
+
+    // remainder = rest * B^low + value[0, low) - quotient^2
+    remainder.resize(low + rest.size());
+    std::copy(value, value + low, remainder.begin());
+    std::copy(rest.begin(), rest.end(), remainder.begin() + low);
+    trim(remainder);
+
+    Limbs squared;
+
+    if (!quotient.empty()) {
+        squared.resize(2 * quotient.size());
+        square(squared.data(), quotient.data(), quotient.size());
+        trim(squared);
+    }
+
+    // A negative remainder is fixed by taking the root one less.
+    if (compareLimbs(remainder.data(), remainder.size(), squared.data(), squared.size()) < 0) {
+        addToRoot(remainder, root.data(), root.size());
+        addToRoot(remainder, root.data(), root.size());
+        subtractLimb(remainder.data(), remainder.data(), remainder.size(), 1);
+
+        subtractLimb(root.data(), root.data(), root.size(), 1);
+        trim(root);
+    }
+    subtractLimbs(remainder.data(), remainder.data(), remainder.size(), squared.data(), squared.size());
+    trim(remainder);
+}
+
+// Square root of the trimmed not empty value with the remainder value - root^2.
+static void sqrtRemainder(Limbs& root, Limbs& remainder, const Limb* value, std::size_t size) {
+    auto half = (size + 1) / 2;
+
+    // The value is shifted by an even count of bits to the normalized one of 2 * half limbs, the
+    // root is shifted back by half the count.
+    auto offset = 2 * half - size;
+    auto shift = static_cast<unsigned>(std::countl_zero(value[size - 1])) & ~1u;
+
+    Limbs normalized(2 * half);
+
+    if (shift != 0) {
+        shiftLeftLimbs(normalized.data() + offset, value, size, shift);
+    } else {
+        std::copy(value, value + size, normalized.begin() + offset);
+    }
+    sqrtNormalized(root, remainder, normalized.data(), half);
+
+    auto rootShift = shift / 2 + static_cast<unsigned>(offset * limbBits / 2);
+
+    if (rootShift == 0) {
+        return;
+    }
+    shiftRightLimbs(root.data(), root.data(), root.size(), rootShift);
+    trim(root);
+
+    Limbs squared(2 * root.size());
+    square(squared.data(), root.data(), root.size());
+    trim(squared);
+
+    remainder.resize(size);
+    std::copy(value, value + size, remainder.begin());
+    subtractLimbs(remainder.data(), remainder.data(), remainder.size(), squared.data(), squared.size());
+    trim(remainder);
+}
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_ROOT_H
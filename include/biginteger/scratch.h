@@ -0,0 +1,153 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_SCRATCH_H
+#define ALEF_NUMERICS_BIGINTEGER_SCRATCH_H
+
+#include "limb.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+// Size in limbs of the first block of the scratch arena.
+#ifndef WINGMANN_BIGINTEGER_SCRATCH_BLOCK_SIZE
+#define WINGMANN_BIGINTEGER_SCRATCH_BLOCK_SIZE 1024
+#endif
+
+namespace wingmann::numerics::__detail {
+
+static constexpr std::size_t scratchBlockSize = WINGMANN_BIGINTEGER_SCRATCH_BLOCK_SIZE;
+
+static_assert(scratchBlockSize >= 1, "scratch block size is too small");
+
+// Stack of limb blocks for temporaries of the algorithms. Allocations bump the position in the
+// current block and are released in the reverse order. Blocks are kept after release, so the
+// arena holds the high-water mark of the thread and stops allocating once it is reached. When
+// the arena becomes empty, several blocks are merged into one of their total size.
+class ScratchArena {
+    struct Block {
+        std::unique_ptr<Limb[]> data;
+        std::size_t capacity;
+    };
+
+    std::vector<Block> blocks_;
+    std::size_t block_{};
+    std::size_t used_{};
+
+public:
+    // Position of the arena restored on release.
+    struct Mark {
+        std::size_t block;
+        std::size_t used;
+    };
+
+    [[nodiscard]]
+    Mark mark() const noexcept { return {block_, used_}; }
+
+    // Allocates limbs of not zero size, the arena is not changed if the allocation fails.
+    Limb* allocate(std::size_t size) {
+        auto block = block_;
+        auto used = used_;
+
+        while (block < blocks_.size() && blocks_[block].capacity - used < size) {
+            ++block;
+            used = 0;
+        }
+        if (block == blocks_.size()) {
+            auto capacity = std::max(size, blocks_.empty() ? scratchBlockSize : 2 * blocks_.back().capacity);
+            blocks_.push_back({std::make_unique_for_overwrite<Limb[]>(capacity), capacity});
+        }
+        block_ = block;
+        used_ = used + size;
+
+        return blocks_[block].data.get() + used;
+    }
+
+    // Releases allocations made after the mark.
+    void release(Mark mark) noexcept {
+        block_ = mark.block;
+        used_ = mark.used;
+
+        if (block_ == 0 && used_ == 0 && blocks_.size() > 1) {
+            merge();
+        }
+    }
+
+    // Gets the arena of the current thread.
+    static ScratchArena& local() noexcept {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+private:
+    void merge() noexcept {
+        auto capacity = std::accumulate(
+            blocks_.begin(), blocks_.end(), std::size_t{}, [](auto sum, const auto& block) {
+                return sum + block.capacity;
+            });
+        auto data = std::unique_ptr<Limb[]>{new (std::nothrow) Limb[capacity]};
+
+        // Keeps the blocks if there is no memory for the merged one.
+        if (data != nullptr) {
+            blocks_.clear();
+            blocks_.push_back({std::move(data), capacity});
+        }
+    }
+};
+
+// Zeroed limbs taken from the scratch arena of the thread for the lifetime of the object.
+// Scratch limbs must be destroyed in the reverse order of construction, so they are only used
+// as local variables.
+class ScratchLimbs {
+    ScratchArena::Mark mark_;
+    Limb* data_{};
+    std::size_t size_;
+
+public:
+    explicit ScratchLimbs(std::size_t size) : mark_{ScratchArena::local().mark()}, size_{size} {
+        if (size != 0) {
+            data_ = ScratchArena::local().allocate(size);
+            std::fill(data_, data_ + size, Limb{});
+        }
+    }
+
+    ScratchLimbs(const Limb* first, const Limb* last)
+        : mark_{ScratchArena::local().mark()},
+          size_{static_cast<std::size_t>(last - first)}
+    {
+        if (size_ != 0) {
+            data_ = ScratchArena::local().allocate(size_);
+            std::copy(first, last, data_);
+        }
+    }
+
+    ScratchLimbs(const ScratchLimbs&) = delete;
+    ScratchLimbs& operator=(const ScratchLimbs&) = delete;
+
+    ~ScratchLimbs() { ScratchArena::local().release(mark_); }
+
+    [[nodiscard]]
+    Limb* data() noexcept { return data_; }
+
+    [[nodiscard]]
+    const Limb* data() const noexcept { return data_; }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept { return size_; }
+
+    Limb& operator[](std::size_t index) noexcept { return data_[index]; }
+
+    const Limb& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+    Limb* begin() noexcept { return data_; }
+
+    const Limb* begin() const noexcept { return data_; }
+
+    Limb* end() noexcept { return data_ + size_; }
+
+    const Limb* end() const noexcept { return data_ + size_; }
+};
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_SCRATCH_H
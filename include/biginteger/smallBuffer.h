@@ -0,0 +1,220 @@
+#ifndef ALEF_NUMERICS_BIGINTEGER_SMALL_BUFFER_H
+#define ALEF_NUMERICS_BIGINTEGER_SMALL_BUFFER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace wingmann::numerics::__detail {
+
+// Contiguous buffer of trivially copyable elements with the vector interface used by the library.
+// Up to InlineCapacity elements are kept in place, larger buffers spill to the memory resource or
+// to the global allocator if there is no resource. The size and capacity take 32 bits each.
+//
+// A copy uses the global allocator unless a resource is given, assignments keep the resource of
+// the target, so a move between different resources copies the elements.
+template<typename T, std::size_t InlineCapacity>
+class SmallBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "elements must be trivially copyable");
+    static_assert(InlineCapacity > 0, "inline capacity must not be zero");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+private:
+    using SizeType = std::uint32_t;
+
+    union {
+        T inline_[InlineCapacity];
+        T* heap_;
+    };
+
+    SizeType size_{};
+    SizeType capacity_{InlineCapacity};
+
+    std::pmr::memory_resource* resource_{};
+
+public:
+    SmallBuffer() noexcept : inline_{} { }
+
+    explicit SmallBuffer(std::pmr::memory_resource* resource) noexcept : inline_{}, resource_{resource} { }
+
+    explicit SmallBuffer(size_type size, std::pmr::memory_resource* resource = nullptr)
+        : SmallBuffer{resource}
+    {
+        resize(size);
+    }
+
+    SmallBuffer(const T* first, const T* last, std::pmr::memory_resource* resource = nullptr)
+        : SmallBuffer{resource}
+    {
+        reserve(static_cast<size_type>(last - first));
+        std::copy(first, last, data());
+        size_ = static_cast<SizeType>(last - first);
+    }
+
+    SmallBuffer(std::initializer_list<T> values) : SmallBuffer{values.begin(), values.end()} { }
+
+    // Copies take the global allocator as pmr containers take the default resource.
+    SmallBuffer(const SmallBuffer& other) : SmallBuffer{other.begin(), other.end()} { }
+
+    SmallBuffer(SmallBuffer&& other) noexcept : SmallBuffer{other.resource_} { steal(other); }
+
+    ~SmallBuffer() { release(); }
+
+    SmallBuffer& operator=(const SmallBuffer& other) {
+        if (this != &other) {
+            size_ = 0;
+            reserve(other.size());
+            std::copy(other.begin(), other.end(), data());
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    SmallBuffer& operator=(SmallBuffer&& other) {
+        if (this == &other) {
+            return *this;
+        }
+        if (resource_ != other.resource_) {
+            *this = other;
+            other.clear();
+        } else {
+            release();
+            steal(other);
+        }
+        return *this;
+    }
+
+    // Gets the memory resource, null for the global allocator.
+    [[nodiscard]]
+    std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+    [[nodiscard]]
+    bool isInline() const noexcept { return capacity_ == InlineCapacity; }
+
+    [[nodiscard]]
+    T* data() noexcept { return isInline() ? inline_ : heap_; }
+
+    [[nodiscard]]
+    const T* data() const noexcept { return isInline() ? inline_ : heap_; }
+
+    [[nodiscard]]
+    size_type size() const noexcept { return size_; }
+
+    [[nodiscard]]
+    size_type capacity() const noexcept { return capacity_; }
+
+    [[nodiscard]]
+    static constexpr size_type max_size() noexcept { return std::numeric_limits<SizeType>::max(); }
+
+    [[nodiscard]]
+    bool empty() const noexcept { return size_ == 0; }
+
+    T& operator[](size_type index) noexcept { return data()[index]; }
+
+    const T& operator[](size_type index) const noexcept { return data()[index]; }
+
+    T& front() noexcept { return data()[0]; }
+
+    const T& front() const noexcept { return data()[0]; }
+
+    T& back() noexcept { return data()[size_ - 1]; }
+
+    const T& back() const noexcept { return data()[size_ - 1]; }
+
+    iterator begin() noexcept { return data(); }
+
+    const_iterator begin() const noexcept { return data(); }
+
+    iterator end() noexcept { return data() + size_; }
+
+    const_iterator end() const noexcept { return data() + size_; }
+
+    // Grows the capacity to at least the given one, the content is kept.
+    void reserve(size_type capacity) {
+        if (capacity <= capacity_) {
+            return;
+        }
+        if (capacity > max_size()) {
+            throw std::length_error{"limb buffer is too long"};
+        }
+        capacity = std::max<size_type>(capacity, std::min<size_type>(2 * size_type{capacity_}, max_size()));
+
+        auto heap = allocate(capacity);
+        std::copy(begin(), end(), heap);
+
+        release();
+        heap_ = heap;
+        capacity_ = static_cast<SizeType>(capacity);
+    }
+
+    // Resizes the buffer, new elements are zeroed.
+    void resize(size_type size) {
+        reserve(size);
+
+        if (size > size_) {
+            std::fill(data() + size_, data() + size, T{});
+        }
+        size_ = static_cast<SizeType>(size);
+    }
+
+    void push_back(T value) {
+        reserve(size_type{size_} + 1);
+        data()[size_++] = value;
+    }
+
+    void pop_back() noexcept { --size_; }
+
+    // Removes elements keeping the capacity.
+    void clear() noexcept { size_ = 0; }
+
+private:
+    T* allocate(size_type capacity) {
+        if (resource_ == nullptr) {
+            return std::allocator<T>{}.allocate(capacity);
+        }
+        return static_cast<T*>(resource_->allocate(capacity * sizeof(T), alignof(T)));
+    }
+
+    // Frees the heap buffer and returns to the inline one, the size is kept.
+    void release() noexcept {
+        if (isInline()) {
+            return;
+        }
+        if (resource_ == nullptr) {
+            std::allocator<T>{}.deallocate(heap_, capacity_);
+        } else {
+            resource_->deallocate(heap_, capacity_ * sizeof(T), alignof(T));
+        }
+        capacity_ = InlineCapacity;
+    }
+
+    // Takes the content of the other buffer leaving it empty, the current buffer must be inline and
+    // share the resource.
+    void steal(SmallBuffer& other) noexcept {
+        if (other.isInline()) {
+            std::copy(other.inline_, other.inline_ + other.size_, inline_);
+        } else {
+            heap_ = other.heap_;
+            capacity_ = other.capacity_;
+            other.capacity_ = InlineCapacity;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+};
+
+} // namespace wingmann::numerics::__detail
+
+#endif // ALEF_NUMERICS_BIGINTEGER_SMALL_BUFFER_H
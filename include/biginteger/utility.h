@@ -5,23 +5,37 @@
 #include "sign.h"
 
 #include <algorithm>
+#include <array>
 #include <ranges>
+#include <string>
 
 namespace wingmann::numerics::__detail {
 
+// Digit values of chars, -1 for not a digit.
+static constexpr auto charDigits = [] {
+    std::array<signed char, 256> digits{};
+    digits.fill(-1);
+
+    for (int i = 0; i < 10; ++i) {
+        digits['0' + i] = static_cast<signed char>(i);
+    }
+    for (int i = 0; i < 6; ++i) {
+        digits['A' + i] = static_cast<signed char>(0xA + i);
+        digits['a' + i] = static_cast<signed char>(0xA + i);
+    }
+    return digits;
+}();
+
+// Gets the digit value of the char, returns -1 for not a digit.
+static constexpr int charToInt32(const char value) {
+    return charDigits[static_cast<unsigned char>(value)];
+}
+
 // Checks for value is valid.
 static bool isValidNumber(const std::string& value, RadixFlag radix) {
-    std::pair range{'0', '9'};
-
-    if (radix == RadixFlag::Binary) {
-        range.second = '1';
-    } else if (radix == RadixFlag::Octal) {
-        range.second = '7';
-    } else if (radix == RadixFlag::Hexadecimal) {
-        range.second = 'F';
-    }
     return std::ranges::all_of(value, [=](const auto c) {
-        return c >= range.first && c <= range.second;
+        auto digit = charToInt32(c);
+        return digit >= 0 && digit < static_cast<int>(radix);
     });
 }
 
@@ -32,16 +46,14 @@ static void removeSign(std::string& value) {
 
 // Removes leading not significant zeros.
 static void removeLeadingZeros(std::string& value) {
-    while (value.starts_with('0') && (value.length() != 1)) {
-        value.erase(0, 1);
+    auto significant = value.find_first_not_of('0');
+
+    if (significant == std::string::npos) {
+        significant = value.empty() ? 0 : value.length() - 1;
     }
+    value.erase(0, significant);
 }
 
-static constexpr auto charToInt32 = [](const char value) {
-    auto number{static_cast<int>(value)};
-    return std::isdigit(value) ? (number - 0x30) : (std::tolower(number - 0x61) + 0xA);
-};
-
 } // namespace wingmann::numerics::__detail
 
 #endif // ALEF_NUMERICS_BIGINTEGER_UTILITY_H
@@ -0,0 +1,47 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_arithmetic, add_assign_accumulate) {
+    wingmann::numerics::BigInteger sum{"-18446744073709551616"};
+
+    for (int i = 0; i < 1000; ++i) {
+        sum += 36'893'488'147'419'103;
+    }
+    EXPECT_EQ(sum, "18446744073709551384");
+}
+
+TEST(wingmann_biginteger_arithmetic, subtract_assign_sign) {
+    wingmann::numerics::BigInteger number{5};
+
+    number -= wingmann::numerics::BigInteger{"18446744073709551621"};
+    EXPECT_EQ(number, "-18446744073709551616");
+
+    number -= number;
+    EXPECT_EQ(number, 0);
+    EXPECT_TRUE(number.isPositive());
+}
+
+TEST(wingmann_biginteger_arithmetic, multiply_divide_assign) {
+    wingmann::numerics::BigInteger number{"340282366920938463463374607431768211457"};
+
+    number *= -3;
+    EXPECT_EQ(number, "-1020847100762815390390123822295304634371");
+
+    number /= wingmann::numerics::BigInteger{"340282366920938463463374607431768211457"};
+    EXPECT_EQ(number, -3);
+
+    number %= 2;
+    EXPECT_EQ(number, -1);
+}
+
+TEST(wingmann_biginteger_arithmetic, increment_decrement_across_zero) {
+    wingmann::numerics::BigInteger number{-1};
+
+    ++number;
+    EXPECT_EQ(number, 0);
+    EXPECT_TRUE(number.isPositive());
+
+    --number;
+    --number;
+    EXPECT_EQ(number, -2);
+}
@@ -35,3 +35,26 @@ TEST(wingmann_biginteger_arithmetic, divide_big_nubers) {
 
     EXPECT_EQ(a / b, "-1065671924559511415122777219324972312367557120547789829150597");
 }
+
+TEST(wingmann_biginteger_arithmetic, divide_reconstruct) {
+    wingmann::numerics::BigInteger a{std::string(600, 'F'), wingmann::numerics::RadixFlag::Hexadecimal};
+    wingmann::numerics::BigInteger b{"8000000000000000" + std::string(300, '0') + "1",
+                                     wingmann::numerics::RadixFlag::Hexadecimal};
+    wingmann::numerics::BigInteger r{std::string(200, '7'), wingmann::numerics::RadixFlag::Hexadecimal};
+
+    EXPECT_EQ((a * b + r) / b, a);
+    EXPECT_EQ((a * b - r) / b, a - 1);
+    EXPECT_EQ((a * b + r) / a, b);
+}
+
+TEST(wingmann_biginteger_arithmetic, divide_recursive) {
+    wingmann::numerics::BigInteger a{std::string(6000, 'F'), wingmann::numerics::RadixFlag::Hexadecimal};
+    wingmann::numerics::BigInteger b{std::string(3000, 'E') + std::string(2000, '0') + "3",
+                                     wingmann::numerics::RadixFlag::Hexadecimal};
+    wingmann::numerics::BigInteger r = b - 1;
+
+    EXPECT_EQ((a * b + r) / b, a);
+    EXPECT_EQ((a * b) / b, a);
+    EXPECT_EQ((a * b - 1) / b, a - 1);
+    EXPECT_EQ((a * b + r) / a, b);
+}
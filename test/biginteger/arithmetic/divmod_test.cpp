@@ -0,0 +1,37 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_arithmetic, divmod_truncated) {
+    using wingmann::numerics::BigInteger;
+
+    EXPECT_EQ(BigInteger{7}.divmod(2), std::make_pair(BigInteger{3}, BigInteger{1}));
+    EXPECT_EQ(BigInteger{-7}.divmod(2), std::make_pair(BigInteger{-3}, BigInteger{-1}));
+    EXPECT_EQ(BigInteger{7}.divmod(-2), std::make_pair(BigInteger{-3}, BigInteger{1}));
+    EXPECT_EQ(BigInteger{-7}.divmod(-2), std::make_pair(BigInteger{3}, BigInteger{-1}));
+}
+
+TEST(wingmann_biginteger_arithmetic, divmod_floored) {
+    using wingmann::numerics::BigInteger;
+
+    EXPECT_EQ(BigInteger{7}.divmodFloor(2), std::make_pair(BigInteger{3}, BigInteger{1}));
+    EXPECT_EQ(BigInteger{-7}.divmodFloor(2), std::make_pair(BigInteger{-4}, BigInteger{1}));
+    EXPECT_EQ(BigInteger{7}.divmodFloor(-2), std::make_pair(BigInteger{-4}, BigInteger{-1}));
+    EXPECT_EQ(BigInteger{-7}.divmodFloor(-2), std::make_pair(BigInteger{3}, BigInteger{-1}));
+    EXPECT_EQ(BigInteger{-8}.divmodFloor(2), std::make_pair(BigInteger{-4}, BigInteger{}));
+}
+
+TEST(wingmann_biginteger_arithmetic, divmod_long_number) {
+    wingmann::numerics::BigInteger a{"-83470328946234832472647364371122002023983749864751122912892393782738361273"};
+    wingmann::numerics::BigInteger b{"78326478367849234732647832547823547326473269472343"};
+
+    auto [quotient, remainder] = a.divmod(b);
+
+    EXPECT_EQ(quotient, a / b);
+    EXPECT_EQ(remainder, a % b);
+    EXPECT_EQ(quotient * b + remainder, a);
+}
+
+TEST(wingmann_biginteger_arithmetic, divmod_throw) {
+    EXPECT_THROW(wingmann::numerics::BigInteger{1}.divmod(0), std::invalid_argument);
+    EXPECT_THROW(wingmann::numerics::BigInteger{1}.divmodFloor(0), std::invalid_argument);
+}
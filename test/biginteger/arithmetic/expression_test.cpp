@@ -0,0 +1,79 @@
+#include <biginteger/bigInteger.h>
+#include <biginteger/expression.h>
+#include <gtest/gtest.h>
+
+using wingmann::numerics::BigInteger;
+using wingmann::numerics::lazy;
+
+TEST(wingmann_biginteger_arithmetic, expression_add_multiply) {
+    BigInteger a{"123456789012345678901234567890"};
+    BigInteger b{"-98765432109876543210"};
+    BigInteger c{"5"};
+
+    BigInteger sum = lazy(a) * b + c;
+    EXPECT_EQ(sum, a * b + c);
+
+    BigInteger reversed = c + a * lazy(b);
+    EXPECT_EQ(reversed, sum);
+
+    c += lazy(a) * a;
+    EXPECT_EQ(c, a * a + 5);
+
+    c.addMultiplyAssign(c, 3);
+    EXPECT_EQ(c, (a * a + 5) * 4);
+}
+
+TEST(wingmann_biginteger_arithmetic, expression_subtract_multiply) {
+    BigInteger x{"1000000000000000000000000000000000000001"};
+    BigInteger y{"33333333333333333333"};
+    BigInteger q{"30000000000000000000"};
+
+    BigInteger difference = x - lazy(y) * q;
+    EXPECT_EQ(difference, x - y * q);
+
+    BigInteger negated = lazy(y) * q - x;
+    EXPECT_EQ(negated, y * q - x);
+
+    x -= lazy(y) * lazy(y);
+    EXPECT_EQ(x, BigInteger{"1000000000000000000000000000000000000001"} - y * y);
+
+    y.subtractMultiplyAssign(y, y);
+    EXPECT_EQ(y, BigInteger{"33333333333333333333"} - BigInteger{"33333333333333333333"}.pow(2));
+}
+
+TEST(wingmann_biginteger_arithmetic, expression_assign) {
+    BigInteger a{"123456789012345678901234567890"};
+    BigInteger b{"-98765432109876543210"};
+    BigInteger x{"5"};
+
+    x = x + lazy(a) * b;
+    EXPECT_EQ(x, a * b + 5);
+
+    BigInteger result{"340282366920938463463374607431768211456"};
+    result = x - lazy(a) * b;
+    EXPECT_EQ(result, 5);
+
+    result = lazy(a) * b - x;
+    EXPECT_EQ(result, -5);
+
+    result = result - lazy(result) * b;
+    EXPECT_EQ(result, -5 + 5 * b);
+
+    a = x - lazy(a) * b;
+    EXPECT_EQ(a, 5);
+}
+
+TEST(wingmann_biginteger_arithmetic, expression_multiply_mod) {
+    BigInteger a{"-340282366920938463463374607431768211457"};
+    BigInteger b{"18446744073709551629"};
+    BigInteger m{"1000000007"};
+
+    BigInteger remainder = lazy(a) * b % m;
+    EXPECT_EQ(remainder, (a * b) % m);
+    EXPECT_EQ(a.multiplyMod(b, a * b - 1), a * b);
+
+    a.multiplyModAssign(a, b);
+    EXPECT_EQ(a, BigInteger{"-340282366920938463463374607431768211457"}.pow(2) % b);
+
+    EXPECT_THROW(auto value = b.multiplyMod(b, 0), std::invalid_argument);
+}
@@ -58,3 +58,47 @@ TEST(wingmann_biginteger_arithmetic, multiply_big_nubers) {
 
     EXPECT_EQ(a * b, expected);
 }
+
+TEST(wingmann_biginteger_arithmetic, multiply_all_ones) {
+    using wingmann::numerics::RadixFlag;
+
+    for (std::size_t digits : {16, 512, 1600, 2400, 8000, 48'000}) {
+        wingmann::numerics::BigInteger a{std::string(digits, 'F'), RadixFlag::Hexadecimal};
+
+        auto expected =
+            std::string(digits - 1, 'F') + 'E' +
+            std::string(digits - 1, '0') + '1';
+
+        EXPECT_EQ((a * a).to_string(RadixFlag::Hexadecimal), expected);
+    }
+}
+
+TEST(wingmann_biginteger_arithmetic, multiply_distributive) {
+    using wingmann::numerics::RadixFlag;
+
+    std::string digits;
+
+    for (std::size_t i = 0; i < 12'000; ++i) {
+        digits.push_back(wingmann::numerics::baseChars(RadixFlag::Hexadecimal).at((i * 7 + i / 13) % 16));
+    }
+    wingmann::numerics::BigInteger a{digits.substr(0, 9000), RadixFlag::Hexadecimal};
+    wingmann::numerics::BigInteger b{digits.substr(1000, 5000), RadixFlag::Hexadecimal};
+    wingmann::numerics::BigInteger c{digits.substr(3000, 7000), RadixFlag::Hexadecimal};
+
+    EXPECT_EQ(a * (b + c), a * b + a * c);
+    EXPECT_EQ((a - b) * (a + b), a * a - b * b);
+}
+
+TEST(wingmann_biginteger_arithmetic, multiply_transform) {
+    using wingmann::numerics::RadixFlag;
+
+    std::string digits;
+
+    for (std::size_t i = 0; i < 48'000; ++i) {
+        digits.push_back(wingmann::numerics::baseChars(RadixFlag::Hexadecimal).at((i * 11 + i / 7) % 16));
+    }
+    wingmann::numerics::BigInteger a{digits.substr(0, 45'000), RadixFlag::Hexadecimal};
+    wingmann::numerics::BigInteger b{digits.substr(5'000, 42'000), RadixFlag::Hexadecimal};
+
+    EXPECT_EQ((a + b) * (a + b) - (a - b) * (a - b), a * b * 4);
+}
@@ -0,0 +1,31 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_arithmetic, rvalue_chain) {
+    wingmann::numerics::BigInteger a{"340282366920938463463374607431768211457"};
+    wingmann::numerics::BigInteger b{"-18446744073709551616"};
+
+    EXPECT_EQ(a + b + a + b, "680564733841876926889855726716117319682");
+    EXPECT_EQ(a * b * 2 / b % a, 0);
+    EXPECT_EQ((a << 64) >> 128, "18446744073709551616");
+}
+
+TEST(wingmann_biginteger_arithmetic, rvalue_right_operand) {
+    wingmann::numerics::BigInteger a{1000};
+
+    EXPECT_EQ(a - wingmann::numerics::BigInteger{1}, 999);
+    EXPECT_EQ(a - (a * 3), -2000);
+    EXPECT_EQ(a + (a * 3), 4000);
+    EXPECT_EQ(a * (a + 1), 1'001'000);
+    EXPECT_EQ(a / (a - 900), 10);
+    EXPECT_EQ(a % (a - 3), 3);
+}
+
+TEST(wingmann_biginteger_arithmetic, rvalue_bitwise) {
+    wingmann::numerics::BigInteger a{0b1100};
+
+    EXPECT_EQ((a + 0) & (a - 2), 0b1000);
+    EXPECT_EQ(a | (a + 1), 0b1101);
+    EXPECT_EQ((a - 12) ^ (a - 13), -1);
+    EXPECT_EQ(~(a * -1), 11);
+}
@@ -0,0 +1,20 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_arithmetic, square_1) {
+    wingmann::numerics::BigInteger a{"-47928462746237462535457589801132323"};
+
+    EXPECT_EQ(a.square(), "2297137541217472289084555982148786130137421359006137928911492955376329");
+    EXPECT_EQ(wingmann::numerics::BigInteger{}.square(), 0);
+}
+
+TEST(wingmann_biginteger_arithmetic, square_long_number) {
+    // Sizes reach every multiplication tier, the copy is multiplied as a distinct operand.
+    for (auto exponent : {500, 3'000, 8'000, 25'000, 200'000}) {
+        auto value = wingmann::numerics::BigInteger{3}.pow(exponent).subtract(1);
+        auto copy{value};
+
+        EXPECT_EQ(value.square(), value * copy);
+        EXPECT_EQ(value * value, value * copy);
+    }
+}
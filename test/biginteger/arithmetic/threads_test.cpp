@@ -0,0 +1,56 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(wingmann_biginteger_arithmetic, threads_share_nothing) {
+    const auto lhs = wingmann::numerics::BigInteger{3}.pow(40000);
+    const auto rhs = wingmann::numerics::BigInteger{7}.pow(20000).add(1);
+    const auto product = lhs * rhs;
+    const auto text = product.to_string();
+
+    std::vector<int> matches(4);
+    std::vector<std::thread> threads;
+
+    for (auto& match : matches) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 4; ++i) {
+                auto value = lhs * rhs;
+                auto [quotient, remainder] = value.divmod(rhs);
+
+                match += (value == product) && (quotient == lhs) && (remainder == 0) && (value.to_string() == text);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(matches, std::vector<int>(4, 4));
+}
+
+TEST(wingmann_biginteger_arithmetic, threads_share_radix_powers) {
+    std::vector<int> matches(4);
+    std::vector<std::thread> threads;
+    std::latch start{static_cast<std::ptrdiff_t>(matches.size())};
+
+    // The values are longer than any converted before, so the threads grow the shared powers
+    // together. 10^n - k is written as nines followed by the digit 10 - k.
+    for (std::size_t i = 0; i < matches.size(); ++i) {
+        threads.emplace_back([&, i] {
+            const auto digits = 300'000 + 20'000 * i;
+            const auto value = wingmann::numerics::BigInteger{digits}.pow10().subtract(i + 1);
+            const auto text = std::string(digits - 1, '9') + static_cast<char>('9' - i);
+
+            start.arrive_and_wait();
+            matches[i] += (value.to_string() == text);
+            matches[i] += (wingmann::numerics::BigInteger{text} == value);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(matches, std::vector<int>(4, 2));
+}
@@ -0,0 +1,26 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_bitwise, and_positive) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{0b1100} & 0b1010, 0b1000);
+}
+
+TEST(wingmann_biginteger_bitwise, and_negative) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{-12} & 10, 0);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-12} & -10, -12);
+    EXPECT_EQ(wingmann::numerics::BigInteger{"-18446744073709551616"} & -1, "-18446744073709551616");
+}
+
+TEST(wingmann_biginteger_bitwise, and_long_number) {
+    wingmann::numerics::BigInteger a{"340282366920938463463374607431768211457"};
+
+    EXPECT_EQ(a & wingmann::numerics::BigInteger{"18446744073709551615"}, 1);
+    EXPECT_EQ(a.bitwiseAnd(a.negate()), 1);
+}
+
+TEST(wingmann_biginteger_bitwise, and_assign) {
+    wingmann::numerics::BigInteger number{255};
+
+    number &= -16;
+    EXPECT_EQ(number, 240);
+}
@@ -0,0 +1,14 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_bitwise, not_value) {
+    EXPECT_EQ(~wingmann::numerics::BigInteger{0}, -1);
+    EXPECT_EQ(~wingmann::numerics::BigInteger{-1}, 0);
+    EXPECT_EQ(~wingmann::numerics::BigInteger{"18446744073709551615"}, "-18446744073709551616");
+}
+
+TEST(wingmann_biginteger_bitwise, not_twice) {
+    wingmann::numerics::BigInteger number{"-340282366920938463463374607431768211457"};
+
+    EXPECT_EQ(number.bitwiseNot().bitwiseNot(), number);
+}
@@ -0,0 +1,25 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_bitwise, or_positive) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{0b1100} | 0b1010, 0b1110);
+}
+
+TEST(wingmann_biginteger_bitwise, or_negative) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{-12} | 10, -2);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-12} | -10, -10);
+}
+
+TEST(wingmann_biginteger_bitwise, or_long_number) {
+    wingmann::numerics::BigInteger a{"340282366920938463463374607431768211456"};
+
+    EXPECT_EQ(a | 1, "340282366920938463463374607431768211457");
+    EXPECT_EQ(a.bitwiseOr(a.negate()), a.negate());
+}
+
+TEST(wingmann_biginteger_bitwise, or_assign) {
+    wingmann::numerics::BigInteger number{-256};
+
+    number |= 15;
+    EXPECT_EQ(number, -241);
+}
@@ -0,0 +1,20 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_bitwise, xor_positive) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{0b1100} ^ 0b1010, 0b0110);
+}
+
+TEST(wingmann_biginteger_bitwise, xor_negative) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{-12} ^ 10, -2);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-12} ^ -10, 2);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-1} ^ wingmann::numerics::BigInteger{"18446744073709551615"},
+              "-18446744073709551616");
+}
+
+TEST(wingmann_biginteger_bitwise, xor_assign) {
+    wingmann::numerics::BigInteger number{"340282366920938463463374607431768211457"};
+
+    number ^= number;
+    EXPECT_EQ(number, 0);
+}
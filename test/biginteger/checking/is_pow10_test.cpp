@@ -9,3 +9,15 @@ TEST(wingmann_biginteger_checking, is_pow10_1) {
 TEST(wingmann_biginteger_checking, is_pow10_2) {
     EXPECT_FALSE(wingmann::numerics::BigInteger{1024}.isPow10());
 }
+
+TEST(wingmann_biginteger_checking, is_pow10_long_number) {
+    auto power = wingmann::numerics::BigInteger{5'000}.pow10();
+
+    EXPECT_TRUE(power.isPow10());
+    EXPECT_TRUE(power.negate().isPow10());
+    EXPECT_TRUE(wingmann::numerics::BigInteger{1}.isPow10());
+    EXPECT_FALSE(wingmann::numerics::BigInteger{0}.isPow10());
+    EXPECT_FALSE(power.add(1).isPow10());
+    EXPECT_FALSE(power.multiply(2).isPow10());
+    EXPECT_FALSE(power.divide(2).isPow10());
+}
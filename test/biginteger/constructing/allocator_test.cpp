@@ -0,0 +1,87 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+TEST(wingmann_biginteger_constructing, allocator_resource) {
+    std::pmr::monotonic_buffer_resource arena;
+    wingmann::numerics::BigInteger::allocator_type allocator{&arena};
+
+    wingmann::numerics::BigInteger number{"340282366920938463463374607431768211456", allocator};
+    EXPECT_EQ(number.get_allocator(), allocator);
+
+    auto product = number * number;
+    EXPECT_EQ(product.get_allocator(), allocator);
+    EXPECT_EQ(product, wingmann::numerics::BigInteger{2}.pow(256));
+
+    wingmann::numerics::BigInteger copy{number, allocator};
+    EXPECT_EQ(copy.get_allocator(), allocator);
+
+    wingmann::numerics::BigInteger global{std::move(number), std::pmr::new_delete_resource()};
+    EXPECT_EQ(global.get_allocator().resource(), std::pmr::new_delete_resource());
+    EXPECT_EQ(global, copy);
+
+    global = std::move(copy);
+    EXPECT_EQ(global.get_allocator().resource(), std::pmr::new_delete_resource());
+    EXPECT_EQ(global, "340282366920938463463374607431768211456");
+}
+
+TEST(wingmann_biginteger_constructing, allocator_container) {
+    std::pmr::monotonic_buffer_resource arena;
+    std::pmr::vector<wingmann::numerics::BigInteger> values{&arena};
+
+    for (int i = 0; i < 100; ++i) {
+        values.emplace_back(i);
+        values.back() <<= i * 3;
+    }
+    EXPECT_EQ(values[99].get_allocator().resource(), &arena);
+    EXPECT_EQ(values[99], wingmann::numerics::BigInteger{2}.pow(297).multiply(99));
+}
+
+TEST(wingmann_biginteger_constructing, allocator_copy) {
+    std::pmr::monotonic_buffer_resource arena;
+    wingmann::numerics::BigInteger::allocator_type allocator{&arena};
+    wingmann::numerics::BigInteger number{"340282366920938463463374607431768211456", allocator};
+
+    wingmann::numerics::BigInteger copy{number};
+    EXPECT_EQ(copy.get_allocator().resource(), std::pmr::new_delete_resource());
+    EXPECT_EQ(copy, number);
+
+    wingmann::numerics::BigInteger assigned{allocator};
+    assigned = copy;
+    EXPECT_EQ(assigned.get_allocator(), allocator);
+    EXPECT_EQ(assigned, number);
+
+    EXPECT_EQ(number.abs().get_allocator(), allocator);
+    EXPECT_EQ(number.pow(1).get_allocator(), allocator);
+    EXPECT_EQ(number.iroot(1).get_allocator(), allocator);
+    EXPECT_EQ(number.mod(copy * copy).get_allocator(), allocator);
+    EXPECT_EQ(number.gcd(copy * copy).get_allocator(), allocator);
+    EXPECT_EQ(number.lcm(copy).get_allocator(), allocator);
+}
+
+TEST(wingmann_biginteger_constructing, allocator_left_operand) {
+    wingmann::numerics::BigInteger global{"18446744073709551616"};
+    std::optional<wingmann::numerics::BigInteger> result;
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        wingmann::numerics::BigInteger::allocator_type allocator{&arena};
+        wingmann::numerics::BigInteger number{"340282366920938463463374607431768211456", allocator};
+
+        result.emplace(global + number * number);
+        EXPECT_EQ(result->get_allocator().resource(), std::pmr::new_delete_resource());
+
+        auto sum = number + 1;
+        EXPECT_EQ(sum.get_allocator(), allocator);
+        EXPECT_EQ(sum, "340282366920938463463374607431768211457");
+
+        EXPECT_EQ((global - number * number).get_allocator().resource(), std::pmr::new_delete_resource());
+        EXPECT_EQ((global * (number + 1)).get_allocator().resource(), std::pmr::new_delete_resource());
+        EXPECT_EQ((global & (number - 1)).get_allocator().resource(), std::pmr::new_delete_resource());
+        EXPECT_EQ((global | (number - 1)).get_allocator().resource(), std::pmr::new_delete_resource());
+        EXPECT_EQ((global ^ (number - 1)).get_allocator().resource(), std::pmr::new_delete_resource());
+    }
+    EXPECT_EQ(*result, wingmann::numerics::BigInteger{2}.pow(256) + wingmann::numerics::BigInteger{2}.pow(64));
+}
@@ -4,3 +4,20 @@
 TEST(wingmann_biginteger_constructing, from_integral_constructor) {
     EXPECT_EQ(wingmann::numerics::BigInteger{2048}, 2048);
 }
+
+TEST(wingmann_biginteger_constructing, from_integral_constructor_wide) {
+    // 128-bit integers are integral types in the GNU modes only.
+    auto check = []<typename Wide>(Wide) {
+        if constexpr (std::integral<Wide>) {
+            using UnsignedWide = std::make_unsigned_t<Wide>;
+
+            EXPECT_EQ(wingmann::numerics::BigInteger{(Wide{1} << 64) + 7}, "18446744073709551623");
+            EXPECT_EQ(wingmann::numerics::BigInteger{-(Wide{1} << 100)}, "-1267650600228229401496703205376");
+            EXPECT_EQ(wingmann::numerics::BigInteger{UnsignedWide{1} << 100}, "1267650600228229401496703205376");
+            EXPECT_EQ(wingmann::numerics::BigInteger{~UnsignedWide{}}, "340282366920938463463374607431768211455");
+        }
+    };
+#ifdef __SIZEOF_INT128__
+    check(__int128{});
+#endif
+}
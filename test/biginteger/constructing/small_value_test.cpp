@@ -0,0 +1,35 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>
+
+TEST(wingmann_biginteger_constructing, small_value_layout) {
+    EXPECT_FALSE(std::is_polymorphic_v<wingmann::numerics::BigInteger>);
+    EXPECT_LE(sizeof(wingmann::numerics::BigInteger), 5 * sizeof(void*));
+}
+
+TEST(wingmann_biginteger_constructing, small_value_grow_and_shrink) {
+    wingmann::numerics::BigInteger number{"340282366920938463463374607431768211455"};
+    auto copy{number};
+
+    ++number;
+    EXPECT_EQ(number, "340282366920938463463374607431768211456");
+
+    --number;
+    EXPECT_EQ(number, copy);
+
+    number = std::move(copy);
+    EXPECT_EQ(number, "340282366920938463463374607431768211455");
+}
+
+TEST(wingmann_biginteger_constructing, small_value_container) {
+    std::vector<wingmann::numerics::BigInteger> values;
+
+    for (int i = 0; i < 100; ++i) {
+        values.emplace_back(i);
+        values.back() <<= i * 3;
+    }
+    EXPECT_EQ(values[1], 8);
+    EXPECT_EQ(values[99], wingmann::numerics::BigInteger{2}.pow(297).multiply(99));
+}
@@ -0,0 +1,67 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_converting, to_string_decimal) {
+    wingmann::numerics::BigInteger number{"-340282366920938463463374607431768211457"};
+
+    EXPECT_EQ(number.to_string(), "-340282366920938463463374607431768211457");
+}
+
+TEST(wingmann_biginteger_converting, to_string_hexadecimal) {
+    wingmann::numerics::BigInteger number{"340282366920938463463374607431768211457"};
+
+    EXPECT_EQ(
+        number.to_string(wingmann::numerics::RadixFlag::Hexadecimal),
+        "100000000000000000000000000000001");
+}
+
+TEST(wingmann_biginteger_converting, to_string_binary) {
+    EXPECT_EQ(
+        wingmann::numerics::BigInteger{-10}.to_string(wingmann::numerics::RadixFlag::Binary),
+        "-1010");
+}
+
+TEST(wingmann_biginteger_converting, to_string_zero) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{}.to_string(wingmann::numerics::RadixFlag::Octal), "0");
+}
+
+TEST(wingmann_biginteger_converting, from_string_hexadecimal) {
+    wingmann::numerics::BigInteger number{"FfFfFfFfFfFfFfFfF", wingmann::numerics::RadixFlag::Hexadecimal};
+
+    EXPECT_EQ(number, "295147905179352825855");
+}
+
+TEST(wingmann_biginteger_converting, to_string_long_decimal) {
+    std::string digits;
+
+    for (int i = 1; i <= 4000; ++i) {
+        digits += std::to_string(i * 7919 % 10007);
+    }
+    wingmann::numerics::BigInteger number{digits};
+    wingmann::numerics::BigInteger power = wingmann::numerics::BigInteger{"1" + std::string(12000, '0')};
+
+    EXPECT_EQ(number.to_string(), digits);
+    EXPECT_EQ(power, wingmann::numerics::BigInteger{10}.pow(12000));
+    EXPECT_EQ((power - 1).to_string(), std::string(12000, '9'));
+    EXPECT_EQ((power + 1).to_string(), "1" + std::string(11999, '0') + "1");
+}
+
+TEST(wingmann_biginteger_converting, to_string_long_power_of_two) {
+    using wingmann::numerics::BigInteger;
+    using wingmann::numerics::RadixFlag;
+
+    std::string hexadecimal;
+
+    for (int i = 1; i <= 3000; ++i) {
+        hexadecimal += "0123456789ABCDEF"[i * 7 % 16];
+    }
+    BigInteger number{hexadecimal, RadixFlag::Hexadecimal};
+    BigInteger octal{std::string(1000, '7'), RadixFlag::Octal};
+
+    EXPECT_EQ(number.to_string(RadixFlag::Hexadecimal), hexadecimal);
+    EXPECT_EQ((BigInteger{number.to_string(RadixFlag::Octal), RadixFlag::Octal}), number);
+    EXPECT_EQ((BigInteger{number.to_string(RadixFlag::Binary), RadixFlag::Binary}), number);
+    EXPECT_EQ(BigInteger{number.to_string()}, number);
+    EXPECT_EQ(octal + 1, BigInteger{8}.pow(1000));
+    EXPECT_EQ((octal + 1).to_string(RadixFlag::Binary), "1" + std::string(3000, '0'));
+}
@@ -4,3 +4,52 @@
 TEST(wingmann_biginteger_math, gcd_1) {
     EXPECT_EQ(2 * 3, wingmann::numerics::BigInteger{2 * 2 * 3}.gcd(2 * 3 * 3));
 }
+
+TEST(wingmann_biginteger_math, gcd_long_number) {
+    auto common = wingmann::numerics::BigInteger{"340282366920938463463374607431768211507"};
+    auto lhs = common * wingmann::numerics::BigInteger{3}.pow(500);
+    auto rhs = common * wingmann::numerics::BigInteger{2}.pow(700).add(1);
+
+    EXPECT_EQ(lhs.gcd(rhs.negate()), common);
+    EXPECT_EQ(lhs.gcd(0), lhs);
+    EXPECT_EQ(wingmann::numerics::BigInteger{0}.gcd(0), 0);
+}
+
+TEST(wingmann_biginteger_math, gcd_ext) {
+    wingmann::numerics::BigInteger lhs{240};
+    wingmann::numerics::BigInteger rhs{-46};
+
+    auto [divisor, x, y] = lhs.gcdExt(rhs);
+    EXPECT_EQ(divisor, 2);
+    EXPECT_EQ(x, -9);
+    EXPECT_EQ(y, -47);
+
+    auto big = wingmann::numerics::BigInteger{7}.pow(300);
+    auto other = wingmann::numerics::BigInteger{10}.pow(200).add(3);
+    auto [longDivisor, longX, longY] = big.gcdExt(other);
+
+    EXPECT_EQ(longDivisor, 1);
+    EXPECT_EQ(longX * big + longY * other, 1);
+}
+
+TEST(wingmann_biginteger_math, gcd_half) {
+    auto common = wingmann::numerics::BigInteger{5}.pow(3000).add(2);
+    auto lhs = common * wingmann::numerics::BigInteger{3}.pow(12000);
+    auto rhs = common * wingmann::numerics::BigInteger{2}.pow(19000).add(1);
+
+    EXPECT_EQ(lhs.gcd(rhs), common);
+
+    auto [divisor, x, y] = lhs.gcdExt(rhs);
+    EXPECT_EQ(divisor, common);
+    EXPECT_EQ(x * lhs + y * rhs, common);
+    EXPECT_LE(x.abs() * 2, rhs / common);
+    EXPECT_LE(y.abs() * 2, lhs / common);
+}
+
+TEST(wingmann_biginteger_math, mod_inverse) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{3}.modInverse(11), 4);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-3}.modInverse(11), 7);
+    EXPECT_EQ(wingmann::numerics::BigInteger{5}.modInverse(1), 0);
+    EXPECT_THROW(auto value = wingmann::numerics::BigInteger{6}.modInverse(9), std::invalid_argument);
+    EXPECT_THROW(auto value = wingmann::numerics::BigInteger{6}.modInverse(0), std::invalid_argument);
+}
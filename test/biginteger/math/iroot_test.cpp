@@ -0,0 +1,35 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_math, iroot_1) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{1'000'000}.iroot(3), 100);
+    EXPECT_EQ(wingmann::numerics::BigInteger{999'999}.iroot(3), 99);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-1'000'000}.iroot(3), -100);
+    EXPECT_EQ(wingmann::numerics::BigInteger{12345}.iroot(1), 12345);
+    EXPECT_EQ(wingmann::numerics::BigInteger{12345}.iroot(100), 1);
+}
+
+TEST(wingmann_biginteger_math, iroot_long_number) {
+    auto root = wingmann::numerics::BigInteger{7}.pow(300).add(1);
+    auto value = root.pow(5);
+
+    EXPECT_EQ(value.iroot(5), root);
+    EXPECT_EQ(value.subtract(1).iroot(5), root.subtract(1));
+    EXPECT_EQ(value.iroot(2), value.sqrt());
+}
+
+TEST(wingmann_biginteger_math, iroot_huge_degree) {
+    auto value = wingmann::numerics::BigInteger{1} << 1000;
+
+    EXPECT_EQ(wingmann::numerics::BigInteger{5}.iroot(10'000'000), 1);
+    EXPECT_EQ(wingmann::numerics::BigInteger{5}.iroot(1ull << 40), 1);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-2}.iroot((1ull << 62) + 1), -1);
+    EXPECT_EQ(value.iroot(1000), 2);
+    EXPECT_EQ(value.subtract(1).iroot(1000), 1);
+    EXPECT_EQ(value.iroot(1001), 1);
+}
+
+TEST(wingmann_biginteger_math, iroot_invalid) {
+    EXPECT_THROW(auto unused = wingmann::numerics::BigInteger{8}.iroot(0), std::invalid_argument);
+    EXPECT_THROW(auto unused = wingmann::numerics::BigInteger{-8}.iroot(2), std::invalid_argument);
+}
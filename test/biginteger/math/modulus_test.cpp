@@ -0,0 +1,51 @@
+#include <biginteger/modulus.h>
+#include <gtest/gtest.h>
+
+using wingmann::numerics::BigInteger;
+using wingmann::numerics::Modulus;
+
+TEST(wingmann_biginteger_math, modulus_odd) {
+    // 2^255 - 19 is prime.
+    Modulus modulus{BigInteger{2}.pow(255).subtract(19)};
+    const auto& m = modulus.value();
+
+    BigInteger a{"-12345678901234567890123456789012345678901234567890"};
+    BigInteger b{"98765432109876543210987654321098765432109876543210987654321"};
+
+    auto x = modulus.toForm(a);
+    auto y = modulus.toForm(b);
+
+    EXPECT_EQ(modulus.fromForm(modulus.multiply(x, y)), (a * b).mod(m).add(m));
+    EXPECT_EQ(modulus.fromForm(modulus.square(y)), (b * b).mod(m));
+    EXPECT_EQ(modulus.fromForm(modulus.add(x, y)), (a + b).mod(m).add(m).mod(m));
+    EXPECT_EQ(modulus.fromForm(modulus.subtract(x, y)), (a - b).mod(m).add(m).mod(m));
+    EXPECT_EQ(modulus.fromForm(modulus.power(y, 1000)), b.powMod(1000, m));
+    EXPECT_EQ(modulus.multiply(modulus.inverse(x), x), modulus.one());
+    EXPECT_EQ(modulus.power(y, -3), modulus.inverse(modulus.power(y, 3)));
+    EXPECT_EQ(modulus.fromForm(modulus.negate(modulus.one())), m - 1);
+}
+
+TEST(wingmann_biginteger_math, modulus_even) {
+    Modulus modulus{BigInteger{10}.pow(50).negate()};
+    const auto& m = modulus.value();
+
+    BigInteger a{"31415926535897932384626433832795028841971693993751058209749445923"};
+    BigInteger b{"27182818284590452353602874713526624977572470936999595749669676277"};
+
+    auto x = modulus.toForm(a);
+    auto y = modulus.toForm(b);
+
+    EXPECT_EQ(x, a.mod(m));
+    EXPECT_EQ(modulus.fromForm(modulus.multiply(x, y)), (a * b).mod(m));
+    EXPECT_EQ(modulus.fromForm(modulus.power(x, 12345)), a.powMod(12345, m));
+    EXPECT_EQ(modulus.multiply(modulus.inverse(y), y), modulus.one());
+    EXPECT_THROW(auto value = modulus.inverse(modulus.toForm(2)), std::invalid_argument);
+}
+
+TEST(wingmann_biginteger_math, modulus_invalid) {
+    EXPECT_THROW(Modulus{0}, std::invalid_argument);
+
+    Modulus modulus{97};
+    EXPECT_THROW(auto value = modulus.multiply(97, 1), std::invalid_argument);
+    EXPECT_THROW(auto value = modulus.add(-1, 1), std::invalid_argument);
+}
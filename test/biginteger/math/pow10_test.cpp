@@ -12,3 +12,12 @@ TEST(wingmann_biginteger_math, pow10_2) {
         wingmann::numerics::BigInteger{64}.pow10(),
         "10000000000000000000000000000000000000000000000000000000000000000");
 }
+
+TEST(wingmann_biginteger_math, pow10_long_number) {
+    for (auto exponent : {0, 1, 19, 37, 1'000, 25'013}) {
+        auto power = wingmann::numerics::BigInteger{exponent}.pow10();
+
+        EXPECT_EQ(power, wingmann::numerics::BigInteger{10}.pow(wingmann::numerics::BigInteger{exponent}));
+        EXPECT_EQ(power.to_string(), "1" + std::string(exponent, '0'));
+    }
+}
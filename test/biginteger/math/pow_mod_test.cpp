@@ -0,0 +1,39 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_math, pow_mod_small) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{4}.powMod(13, 497), 445);
+    EXPECT_EQ(wingmann::numerics::BigInteger{-4}.powMod(13, 497), 52);
+    EXPECT_EQ(wingmann::numerics::BigInteger{3}.powMod(200, 1000), 1);
+    EXPECT_EQ(wingmann::numerics::BigInteger{5}.powMod(0, 7), 1);
+    EXPECT_EQ(wingmann::numerics::BigInteger{5}.powMod(0, -1), 0);
+    EXPECT_EQ(wingmann::numerics::BigInteger{14}.powMod(3, 7), 0);
+}
+
+TEST(wingmann_biginteger_math, pow_mod_fermat) {
+    // 2^521 - 1 is prime.
+    auto modulus = wingmann::numerics::BigInteger{2}.pow(521).subtract(1);
+    auto base = wingmann::numerics::BigInteger{"123456789012345678901234567890123456789"};
+
+    EXPECT_EQ(base.powMod(modulus - 1, modulus), 1);
+    EXPECT_EQ(base.powMod(modulus, modulus), base);
+    EXPECT_EQ(base.powMod(modulus - 2, modulus).multiplyMod(base, modulus), 1);
+}
+
+TEST(wingmann_biginteger_math, pow_mod_even_modulus) {
+    auto modulus = wingmann::numerics::BigInteger{10}.pow(40);
+    auto base = wingmann::numerics::BigInteger{"987654321987654321987654321"};
+
+    EXPECT_EQ(base.powMod(5, modulus), base.pow(5).mod(modulus));
+    EXPECT_EQ(base.powMod(123, modulus.negate()), base.pow(123).mod(modulus));
+}
+
+TEST(wingmann_biginteger_math, pow_mod_invalid) {
+    EXPECT_THROW(auto value = wingmann::numerics::BigInteger{2}.powMod(3, 0), std::invalid_argument);
+    EXPECT_THROW(auto value = wingmann::numerics::BigInteger{2}.powMod(-3, 6), std::invalid_argument);
+}
+
+TEST(wingmann_biginteger_math, pow_mod_negative_exponent) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{2}.powMod(-3, 5), 2);
+    EXPECT_EQ(wingmann::numerics::BigInteger{3}.powMod(-1, 1000), 667);
+}
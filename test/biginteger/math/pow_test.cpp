@@ -20,3 +20,37 @@ TEST(wingmann_biginteger_math, pow_4) {
 TEST(wingmann_biginteger_math, pow_5) {
     EXPECT_EQ(wingmann::numerics::BigInteger{-128}.pow(-64), 0);
 }
+
+TEST(wingmann_biginteger_math, pow_unsigned) {
+    auto power = wingmann::numerics::BigInteger{-12}.pow(std::uint64_t{1001});
+
+    EXPECT_EQ(power, wingmann::numerics::BigInteger{3}.pow(1001).negate() << 2002);
+    EXPECT_EQ(power, wingmann::numerics::BigInteger{-12}.pow(wingmann::numerics::BigInteger{1001}));
+}
+
+TEST(wingmann_biginteger_math, pow_power_of_two) {
+    EXPECT_EQ(wingmann::numerics::BigInteger{-1024}.pow(7), wingmann::numerics::BigInteger{-1} << 70);
+    EXPECT_EQ(wingmann::numerics::BigInteger{2}.pow(100'000), wingmann::numerics::BigInteger{1} << 100'000);
+}
+
+TEST(wingmann_biginteger_math, pow_too_long) {
+    auto exponent = wingmann::numerics::BigInteger{1} << 64;
+
+    EXPECT_EQ(wingmann::numerics::BigInteger{-1}.pow(exponent), 1);
+    EXPECT_THROW(auto unused = wingmann::numerics::BigInteger{3}.pow(exponent), std::length_error);
+}
+
+TEST(wingmann_biginteger_math, pow_wide_exponent) {
+    // 128-bit integers are integral types in the GNU modes only.
+    auto check = []<typename Wide>(Wide) {
+        if constexpr (std::integral<Wide>) {
+            EXPECT_EQ(wingmann::numerics::BigInteger{3}.pow(Wide{5}), 243);
+            EXPECT_EQ(wingmann::numerics::BigInteger{-1}.pow((Wide{1} << 64) + 5), -1);
+            EXPECT_THROW(auto unused = wingmann::numerics::BigInteger{3}.pow((Wide{1} << 64) + 5), std::length_error);
+            EXPECT_THROW(auto unused = wingmann::numerics::BigInteger{3}.pow(Wide{1} << 64), std::length_error);
+        }
+    };
+#ifdef __SIZEOF_INT128__
+    check(__int128{});
+#endif
+}
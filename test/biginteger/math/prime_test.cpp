@@ -0,0 +1,44 @@
+#include <biginteger/bigInteger.h>
+#include <gtest/gtest.h>
+
+TEST(wingmann_biginteger_math, is_probable_prime_1) {
+    using wingmann::numerics::BigInteger;
+
+    EXPECT_FALSE(BigInteger{0}.isProbablePrime());
+    EXPECT_FALSE(BigInteger{1}.isProbablePrime());
+    EXPECT_TRUE(BigInteger{2}.isProbablePrime());
+    EXPECT_TRUE(BigInteger{2039}.isProbablePrime());
+    EXPECT_FALSE(BigInteger{2047}.isProbablePrime());
+    EXPECT_FALSE(BigInteger{-7}.isProbablePrime());
+    EXPECT_TRUE(BigInteger{"2305843009213693951"}.isProbablePrime());
+}
+
+TEST(wingmann_biginteger_math, is_probable_prime_pseudoprimes) {
+    using wingmann::numerics::BigInteger;
+
+    // Strong pseudoprimes to base 2 without small factors: 3511^2 and the one to bases 2 to 23.
+    EXPECT_FALSE(BigInteger{12327121}.isProbablePrime());
+    EXPECT_FALSE(BigInteger{"3825123056546413051"}.isProbablePrime());
+    EXPECT_FALSE(BigInteger{"318665857834031151167461"}.isProbablePrime(10));
+}
+
+TEST(wingmann_biginteger_math, is_probable_prime_long_number) {
+    using wingmann::numerics::BigInteger;
+
+    auto mersenne = BigInteger{2}.pow(521).subtract(1);
+    auto other = BigInteger{2}.pow(607).subtract(1);
+
+    EXPECT_TRUE(mersenne.isProbablePrime(5));
+    EXPECT_FALSE((mersenne * other).isProbablePrime());
+    EXPECT_FALSE(BigInteger{2}.pow(523).subtract(1).isProbablePrime());
+}
+
+TEST(wingmann_biginteger_math, next_prime) {
+    using wingmann::numerics::BigInteger;
+
+    EXPECT_EQ(BigInteger{-5}.nextPrime(), 2);
+    EXPECT_EQ(BigInteger{2}.nextPrime(), 3);
+    EXPECT_EQ(BigInteger{2039}.nextPrime(), 2053);
+    EXPECT_EQ((BigInteger{1} << 64).nextPrime(), (BigInteger{1} << 64).add(13));
+    EXPECT_EQ(BigInteger{100}.pow10().nextPrime(), BigInteger{100}.pow10().add(267));
+}
@@ -8,3 +8,17 @@ TEST(wingmann_biginteger_math, sqrt_1) {
 TEST(wingmann_biginteger_math, sqrt_2) {
     EXPECT_EQ(wingmann::numerics::BigInteger{104'857'600}.sqrt(), 10'240);
 }
+
+TEST(wingmann_biginteger_math, sqrt_rem) {
+    auto root = wingmann::numerics::BigInteger{3}.pow(2000).add(7);
+    auto value = root * root + root;
+
+    auto [result, remainder] = value.sqrtRem();
+    EXPECT_EQ(result, root);
+    EXPECT_EQ(remainder, root);
+
+    EXPECT_EQ(value.sqrt(), root);
+    EXPECT_EQ(value.subtract(1).sqrt(), root);
+    EXPECT_EQ(wingmann::numerics::BigInteger{0}.sqrtRem().second, 0);
+    EXPECT_THROW(auto unused = wingmann::numerics::BigInteger{-4}.sqrtRem(), std::invalid_argument);
+}
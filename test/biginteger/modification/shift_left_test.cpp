@@ -18,3 +18,24 @@ TEST(wingmann_biginteger_modification, shift_left_throw) {
         auto temp = wingmann::numerics::BigInteger{10}.shiftLeft(-2),
         std::invalid_argument);
 }
+
+TEST(wingmann_biginteger_modification, shift_left_long) {
+    wingmann::numerics::BigInteger number{"-340282366920938463463374607431768211457"};
+    std::size_t count{1'000'000};
+
+    EXPECT_EQ(number << count, number * wingmann::numerics::BigInteger{2}.pow(1'000'000));
+    EXPECT_EQ(number << wingmann::numerics::BigInteger{128}, number * wingmann::numerics::BigInteger{2}.pow(128));
+}
+
+TEST(wingmann_biginteger_modification, shift_left_assign) {
+    wingmann::numerics::BigInteger number{1};
+
+    number <<= 64;
+    EXPECT_EQ(number, "18446744073709551616");
+
+    number <<= 0;
+    EXPECT_EQ(number, "18446744073709551616");
+
+    number <<= 3;
+    EXPECT_EQ(number, "147573952589676412928");
+}
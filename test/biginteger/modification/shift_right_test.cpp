@@ -18,3 +18,26 @@ TEST(wingmann_biginteger_modification, shift_right_throw) {
         auto temp = wingmann::numerics::BigInteger{10}.shiftRight(-2),
         std::invalid_argument);
 }
+
+TEST(wingmann_biginteger_modification, shift_right_long) {
+    wingmann::numerics::BigInteger number = wingmann::numerics::BigInteger{3}.pow(5000);
+    std::size_t count{1000};
+
+    EXPECT_EQ(number >> count, number / wingmann::numerics::BigInteger{2}.pow(1000));
+    EXPECT_EQ(number >> wingmann::numerics::BigInteger{"100000000000000000000000"}, 0);
+    EXPECT_EQ(number.negate() >> 7924, -1);
+    EXPECT_EQ(number.negate() >> 7925, 0);
+}
+
+TEST(wingmann_biginteger_modification, shift_right_assign) {
+    wingmann::numerics::BigInteger number{"147573952589676412929"};
+
+    number >>= 3;
+    EXPECT_EQ(number, "18446744073709551616");
+
+    number >>= 64;
+    EXPECT_EQ(number, 1);
+
+    number >>= 1;
+    EXPECT_EQ(number, 0);
+}